@@ -18,7 +18,7 @@
 #include "xml.h"
 #include "xmlfile.h"
 #include "xmlreader.h"
-#include "xml_tree_browser.h"
+#include "xmlstreamreader.h"
 
 using namespace std;
 using namespace MusicXML2;
@@ -47,25 +47,25 @@ struct predicate {
 //_______________________________________________________________________________
 static int read(FILE * fd)
 {
+#ifdef use_visitor
+	// the notes are counted while the file is parsed, the tree is not built
+	countnotes v;
+	xmlstreamreader r(&v);
+	return r.read(fd) ? v.fCount : -1;
+#else // use iterator
 	int count = 0;
 	xmlreader r;
 	SXMLFile file = r.read(fd);
 	if (file) {
 		Sxmlelement elt = file->elements();
 		if (elt) {
-#ifdef use_visitor
-			countnotes v;
-			xml_tree_browser browser(&v);
-			browser.browse(*elt);
-			count = v.fCount;
-#else // use iterator
 			predicate p;
 			count = count_if(elt->begin(), elt->end(), p);
-#endif
 		}
 	}
 	else count = -1;
 	return count;
+#endif
 }
 
 //_______________________________________________________________________________
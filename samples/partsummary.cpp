@@ -13,13 +13,13 @@
 
 #include <string.h>
 #include <iostream>
+#include <stdexcept>
 
 #include "xml.h"
 #include "xmlfile.h"
-#include "xmlreader.h"
+#include "xmlstreamreader.h"
 #include "partsummary.h"
 #include "smartlist.h"
-#include "xml_tree_browser.h"
 
 using namespace std;
 using namespace MusicXML2;
@@ -73,20 +73,16 @@ void mypartsummary::visitEnd ( S_part& elt)
 int main(int argc, char *argv[]) 
 {
 	const char * file = argc > 1 ? argv[1] : "-";
-	xmlreader r;
-	SXMLFile xmlfile;
-	if (strcmp(file, "-"))
-		xmlfile = r.read(file);
-	else
-		xmlfile= r.read(stdin);
-	if (xmlfile) {
-		Sxmlelement elt = xmlfile->elements();
-		if (elt) {
-			mypartsummary nv;
-			xml_tree_browser browser(&nv);
-			browser.browse(*elt);
-		}
+	// the summary is computed while the file is parsed, the tree is not built
+	mypartsummary nv;
+	xmlstreamreader r(&nv);
+	try {
+		bool done = strcmp(file, "-") ? r.read(file) : r.read(stdin);
+		if (!done) cerr << "error reading \"" << file << "\"" << endl;
+	}
+	catch (std::overflow_error& e) {
+		cerr << "partsummary: " << e.what() << endl;
+		return 1;
 	}
-	else cerr << "error reading \"" << file << "\"" << endl;
 	return 0;
 }
@@ -27,6 +27,7 @@ using namespace MusicXML2;
 static void usage() {
 	cerr << "usage: xml2guido [options]  <musicxml file>" << endl;
 	cerr << "       reads stdin when <musicxml file> is '-'" << endl;
+	cerr << "       compressed MusicXML files are recognized by their .mxl extension" << endl;
 	cerr << "       option: --autobars don't generates barlines" << endl;
 	cerr << "       option: --version print version and exit" << endl;
 	exit(1);
@@ -90,6 +91,8 @@ int main(int argc, char *argv[])
 	xmlErr err = kNoErr;
 	if (!strcmp(file, "-"))
 		err = musicxmlfd2guido(stdin, generateBars, cout);
+	else if ((strlen(file) > 4) && !strcmp(file + strlen(file) - 4, ".mxl"))
+		err = musicxmlmxlfile2guido(file, generateBars, cout);
 	else
 		err = musicxmlfile2guido(file, generateBars, cout);
 	if (err == kUnsupported)
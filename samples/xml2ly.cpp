@@ -668,7 +668,7 @@ int main (int argc, char *argv[])
   // ------------------------------------------------------
 
   if (gGeneralOptions->fDisplayCPUusage)
-    timing::gTiming.print (
+    gTiming.print (
       gLogIOstream);
 
   // check indentation
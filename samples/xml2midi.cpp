@@ -11,13 +11,16 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <iostream>
 
 #include "xml.h"
 #include "xmlfile.h"
 #include "xmlreader.h"
 #include "midicontextvisitor.h"
+#include "midifile.h"
 #include "unrolled_xml_tree_browser.h"
 
 using namespace std;
@@ -51,22 +54,58 @@ class mymidiwriter : public midiwriter {
 			{ cout << date << " progChange chan " << chan << " prog " << prog << endl; }
 };
 
+//_______________________________________________________________________________
+static void usage() {
+	cerr << "usage: xml2midi [file] [-o midifile]" << endl;
+	cerr << "       prints the MIDI events of a MusicXML file" << endl;
+	cerr << "       or writes a Standard MIDI File when -o is used" << endl;
+	cerr << "       reads the standard input when file is '-' or missing" << endl;
+	exit(1);
+}
+
 //_______________________________________________________________________________
 int main(int argc, char *argv[]) {
-	char * file = argv[1];
+	const char * file = 0;
+	const char * midi = 0;
+	for (int i = 1; i < argc; i++) {
+		if (!strcmp(argv[i], "-o")) {
+			if (++i == argc) usage();
+			midi = argv[i];
+		}
+		else if (!file) file = argv[i];
+		else usage();
+	}
+
 	xmlreader r;
 	SXMLFile xmlfile;
-	if ((argc > 1) && strcmp(file, "-"))
+	if (file && strcmp(file, "-"))
 		xmlfile = r.read(file);
 	else
 		xmlfile = r.read(stdin);
 	if (xmlfile) {
 		Sxmlelement st = xmlfile->elements();
 		if (st) {
-			mymidiwriter writer;
-			midicontextvisitor v(480, &writer);
-			unrolled_xml_tree_browser browser(&v);
-			browser.browse(*st);
+			if (midi) {
+				clock_t start = clock();
+				midifile writer(480);
+				midicontextvisitor v(480, &writer);
+				unrolled_xml_tree_browser browser(&v);
+				browser.browse(*st);
+				if (!writer.write(midi)) {
+					cerr << "can't write " << midi << endl;
+					return 1;
+				}
+				double elapsed = double(clock() - start) / CLOCKS_PER_SEC;
+				cerr << writer.countNotes() << " notes in " << writer.countTracks() << " tracks";
+				if (elapsed > 0) cerr << " (" << long(writer.countNotes() / elapsed) << " notes/s)";
+				cerr << endl;
+			}
+			else {
+				mymidiwriter writer;
+				midicontextvisitor v(480, &writer);
+				unrolled_xml_tree_browser browser(&v);
+				browser.browse(*st);
+			}
 		}
 	}
 	return 0;
@@ -14,8 +14,8 @@
 #define __factory__
 
 #include <string>
-#include <map>
-#include "functor.h"
+#include <vector>
+#include "perfecthash.h"
 #include "singleton.h"
 #include "xml.h"
 
@@ -27,16 +27,33 @@ namespace MusicXML2
 @{
 */
 
+/*!
+\brief the MusicXML elements factory.
+
+	Elements are created in constant time, either by type or by name:
+	the creators and the names are indexed by type and the names are
+	mapped to the types using a perfect hash.
+*/
 class EXP factory : public singleton<factory>{
 
-	std::map<std::string, functor<Sxmlelement>*> fMap;
-	std::map<int, const char*>	fType2Name;
+	typedef Sxmlelement (*creator)(int inputLineNumber, arena* a);
+
+	std::vector<creator>		fCreators;		///< the elements creators, indexed by type
+	std::vector<std::string>	fType2Name;		///< the elements names, indexed by type and shared by the elements
+	perfecthash					fName2Type;		///< the elements types, indexed by name
+
+	void add (int type, const char* name, creator f);
+
 	public:
 				 factory();
 		virtual ~factory() {}
 
-		Sxmlelement create(const std::string& elt) const;	
-		Sxmlelement create(int type) const;	
+		//! creates an element, allocated from the arena a when not null
+		Sxmlelement create(const std::string& elt, int inputLineNumber=0, arena* a=0) const;	
+		Sxmlelement create(const char* elt, int inputLineNumber=0, arena* a=0) const;	
+		Sxmlelement create(int type, int inputLineNumber=0, arena* a=0) const;	
+		//! returns the name of an element type, shared by its elements, null for the unknown names
+		const std::string* name(const std::string& elt) const;
 };
 
 }
@@ -33,20 +33,14 @@ case $3 in
     # to standard output
     cat $2/license.txt $2/factory.txt
 
-    # generate fMap entries for the markups found in the DTD
-   for a in $(cat $1 | cut -d' ' -f1 | sort -u)
-    do
-      echo "  fMap[\"$a\"]  = new newElementFunctor<$(kname $a)>;"
-    done
-    echo
-
-    # generate fType2Name entries for the markups found in the DTD
+    # generate the factory entries for the markups found in the DTD
     for a in $(cat $1 | cut -d' ' -f1 | sort -u)
     do
-      echo "  fType2Name[$(kname $a)]   = \"$a\";"
+      echo "  add ($(kname $a), \"$a\", newElement<$(kname $a)>);"
     done
 
     # generate epiloque
+    echo '  fName2Type.build (fType2Name);'
     echo '}'
     echo '}'
     ;;
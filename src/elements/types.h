@@ -14,6 +14,7 @@
 #define __types__
 
 #include "exports.h"
+#include "elements.h"
 #include "xml.h"
 #include "visitor.h"
 
@@ -25,7 +26,23 @@ namespace MusicXML2
 @{
 */
 
-template <int elt> class musicxml : public xmlelement
+//______________________________________________________________________________
+/*!
+\brief the data attached to the elements of a given type: none by default
+*/
+template <int elt> class elementdata {};
+
+/*!
+\brief the parts keep their summary, computed once and shared by the visitors (see partsummary::get)
+*/
+template <> class elementdata<k_part>
+{
+	public:
+		SMARTP<smartable>	fSummary;
+};
+
+//______________________________________________________________________________
+template <int elt> class musicxml : public xmlelement, public elementdata<elt>
 { 
   protected:  
     musicxml (int inputLineNumber) : xmlelement (inputLineNumber)	{ fType = elt; }
@@ -39,25 +56,46 @@ template <int elt> class musicxml : public xmlelement
       { musicxml<elt>* o = new musicxml<elt>(elts); assert(o!=0); return o; }
   */
   
-	static SMARTP<musicxml<elt> > new_musicxml (int inputLineNumber)  
-		{ musicxml<elt>* o = new musicxml<elt>(inputLineNumber); assert(o!=0); return o; }
+	static SMARTP<musicxml<elt> > new_musicxml (int inputLineNumber, arena* a=0)  
+		{ musicxml<elt>* o = a ? new (a) inarena<musicxml<elt> >(inputLineNumber) : new musicxml<elt>(inputLineNumber); assert(o!=0); return o; }
     static SMARTP<musicxml<elt> > new_musicxml ( const std::vector<Sxmlelement>& elts, int inputLineNumber)  
 		{ musicxml<elt>* o = new musicxml<elt>(elts, inputLineNumber); assert(o!=0); return o; }
 
+    typedef visitor<SMARTP<musicxml<elt> > > typedvisitor;
+
+	// resolves the visitor interfaces for the element type, once per visitor
+	static basevisitor::interfaces& resolve (basevisitor& v) {
+		basevisitor::interfaces& i = v.dispatch (elt);
+		if (!i.fResolved) {
+			i.fTyped	= dynamic_cast<typedvisitor*>(&v);
+			i.fGeneric	= dynamic_cast<visitor<Sxmlelement>*>(&v);
+			i.fResolved	= true;
+		}
+		return i;
+	}
+
     virtual void acceptIn (basevisitor& v) {
-		if (visitor<SMARTP<musicxml<elt> > >* p = dynamic_cast<visitor<SMARTP<musicxml<elt> > >*>(&v)) {
-			SMARTP<musicxml<elt> > sptr = this;
-			p->visitStart (sptr);
+		basevisitor::interfaces& i = resolve (v);
+		if (i.fTyped) {
+			typename borrowed<musicxml<elt> >::ref sptr (this);
+			static_cast<typedvisitor*>(i.fTyped)->visitStart (sptr);
+		}
+		else if (i.fGeneric) {
+			borrowed<xmlelement>::ref sptr (this);
+			static_cast<visitor<Sxmlelement>*>(i.fGeneric)->visitStart (sptr);
 		}
-		else xmlelement::acceptIn (v);
 	}
 
     virtual void acceptOut (basevisitor& v) {
-        if ( visitor<SMARTP<musicxml<elt> > >* p = dynamic_cast<visitor<SMARTP<musicxml<elt> > >*>(&v)) {
-			SMARTP<musicxml<elt> > sptr = this;
-			p->visitEnd (sptr);
-        }
-        else xmlelement::acceptOut (v);
+		basevisitor::interfaces& i = resolve (v);
+		if (i.fTyped) {
+			typename borrowed<musicxml<elt> >::ref sptr (this);
+			static_cast<typedvisitor*>(i.fTyped)->visitEnd (sptr);
+		}
+		else if (i.fGeneric) {
+			borrowed<xmlelement>::ref sptr (this);
+			static_cast<visitor<Sxmlelement>*>(i.fGeneric)->visitEnd (sptr);
+		}
 	}
 };
 
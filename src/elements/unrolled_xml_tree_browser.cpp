@@ -44,6 +44,13 @@ void unrolled_xml_tree_browser::visitStart( Sxmlelement& elt)
 	if (forward) leave(*elt);
 }
 
+//______________________________________________________________________________
+static bool startsEnding (const Sxmlelement& measure)
+{
+	borrowed<xmlelement> ending = measure->getSubElement(k_ending);
+	return ending && (ending->getAttributeValue("type") == "start");
+}
+
 //______________________________________________________________________________
 void unrolled_xml_tree_browser::visitStart( S_ending& elt)
 {
@@ -57,6 +64,11 @@ void unrolled_xml_tree_browser::visitStart( S_ending& elt)
 		if (fSectionIndex > 1) fExpectedRound.current = number;
 	}
 	else if ((type == "stop") || (type == "discontinue")) {
+		// an ending played and not followed by a backward repeat terminates the section
+		// (except the endings of the first round: the repeat sign is likely misplaced)
+		// a skipped ending terminates the section when no other ending follows
+		if (!played()) fEndingSkipped = true;
+		else if (fRound.current > 1) fSectionEnd = true;
 		fExpectedRound.next = kNoInstruction;			// no specific round expected at next iteration
 	}
 }
@@ -69,25 +81,41 @@ void unrolled_xml_tree_browser::visitStart( S_repeat& elt)
 	int times = elt->getAttributeIntValue("times", 1);
 
 	if (direction == "backward") {
+		// a repeat in a skipped measure (e.g. in another ending) is ignored once the section has been repeated
+		if (fJump.current == kToCoda) return;
+		if (!played() && (fRound.current > 1)) return;
 		fRepeatMap[elt]++;		// intended to catch possible loop
 		// check first for times to play the repeat section and for possible loop
 		if ((fRound.current <= times) && (fRepeatMap[elt] <= times)) {
 			fNextIterator = fForwardRepeat;			// jump to fForwardRepeat at next iteration
 			fRound.next = fRound.current + 1;			// increments the current round at next iteration
 			fExpectedRound.next = fRound.current + 1;	// and adjust the corresponding round for next iteration
+			fSectionEnd = fEndingSkipped = false;		// an ending in this measure doesn't terminate the section
 		}
-		else {											// jump out of the repeat section:
-			fRound.next = 1;							// next round will be 1
-			fExpectedRound.next = kNoInstruction;		// no specific round expected at next iteration
-			fSectionIndex = 0;							// and starts a new section
-		}
+		else fSectionEnd = true;						// jump out of the repeat section
 	}
 	else if (direction == "forward") {
-		// current measure iterator will be stored in the fForwardRepeat location
-		fStoreIterator = &fForwardRepeat;
+		// the section starts with the current measure, or with the next one when the repeat
+		// is at the end of the measure. The location is set now: the section can end in the same measure.
+		// A forward repeat with an ending start is ignored: a section can't start with an ending.
+		if (fRightBarline) {
+			fForwardRepeat = fCurrentMeasure;
+			fForwardRepeat++;
+		}
+		else if (!startsEnding(*fCurrentMeasure)) fForwardRepeat = fCurrentMeasure;
 	}
 }
 
+//______________________________________________________________________________
+void unrolled_xml_tree_browser::visitStart( S_barline& elt)
+{
+	// the default barline location is right
+	string location = elt->getAttributeValue("location");
+	fRightBarline = (location != "left") && (location != "middle");
+	Sxmlelement xml = elt;
+	visitStart(xml);
+}
+
 //______________________________________________________________________________
 void unrolled_xml_tree_browser::visitStart( S_measure& elt)
 {
@@ -105,21 +133,42 @@ void unrolled_xml_tree_browser::visitStart( S_measure& elt)
 		fJump.current = fJump.next;
 		fJump.next = kNoJump;
 	}
+	if (fEndingSkipped) {
+		fEndingSkipped = false;
+		if (!startsEnding(elt)) fSectionEnd = true;
+	}
+	if (fSectionEnd) startSection();
 	fSectionIndex++;
 
 	// next visit the measure
 	visitStart(xml);
 	// and according to the current state, forward the visit to the embedded visitor
-	if (fJump.current != kToCoda) {		// check that we're not looking for the coda sign
-										// and check that we're playing the correct round
-		if ((fExpectedRound.current == kNoInstruction) || (fRound.current == fExpectedRound.current))
-			forwardBrowse (*elt);
-	}
+	if (played()) forwardBrowse (*elt);
+}
+
+//______________________________________________________________________________
+// check that we're not looking for the coda sign and that we're playing the correct round
+bool unrolled_xml_tree_browser::played() const
+{
+	if (fJump.current == kToCoda) return false;
+	return (fExpectedRound.current == kNoInstruction) || (fRound.current == fExpectedRound.current);
+}
+
+//______________________________________________________________________________
+// the current measure starts a new section, that can be repeated without forward repeat
+void unrolled_xml_tree_browser::startSection()
+{
+	fRound.current = 1;							// this is the first time we visit the section
+	fExpectedRound.current = kNoInstruction;	// and there is no specific instruction for the round
+	fSectionIndex = 0;
+	fForwardRepeat = fCurrentMeasure;
+	fSectionEnd = false;
 }
 
 //______________________________________________________________________________
 void unrolled_xml_tree_browser::reset()
 {
+	fSectionEnd = fEndingSkipped = false;
 	fRepeatMap.clear();								// clear the map of backward repeat measures
 	fSectionIndex = 0;
 	fRound.current = 1;	fRound.next = kNoInstruction;	// this is the first time we visit the part
@@ -148,9 +197,11 @@ void unrolled_xml_tree_browser::visitStart( S_part& elt)
 	fSegnoIterator= fCodaIterator = fEndIterator;
 	// stores the first measures and makes a provision for the forward repeat location
 	ctree<xmlelement>::literator iter = elt->elements().begin();
-	fFirstMeasure = fForwardRepeat = iter;
+	fFirstMeasure = fForwardRepeat = fCurrentMeasure = iter;
+	fRightBarline = false;
 	fStoreIterator = 0;
 	fStoreDelay = 0;
+	fJump.current = fJump.next = kNoJump;
 
 	reset();
 
@@ -158,7 +209,7 @@ void unrolled_xml_tree_browser::visitStart( S_part& elt)
 	fForward = false;
 	// while we're not at the end location (elements().end() is checked for safety reasons only)
 	while ((iter != fEndIterator) && (iter != elt->elements().end())) {
-		fNextIterator = iter;
+		fCurrentMeasure = fNextIterator = iter;
 		fNextIterator++;				// default value for next iterator is the next measure
 		browse(**iter);					// browse the measure
 		if (fStoreIterator) {			// check if we need to store the current iterator
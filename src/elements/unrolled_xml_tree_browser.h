@@ -52,6 +52,7 @@ class EXP unrolled_xml_tree_browser : public browser<xmlelement>,
 	public visitor<S_measure>,
 	public visitor<S_ending>,
 	public visitor<S_repeat>,
+	public visitor<S_barline>,
 	public visitor<S_part>,
 	public visitor<S_sound>
 {
@@ -67,13 +68,19 @@ class EXP unrolled_xml_tree_browser : public browser<xmlelement>,
 		state	fRound;			///< the current time we're visiting a section
 		state	fExpectedRound;	///< the expected time to visit a section (0 when no instruction)
 		int		fSectionIndex;	///< the current measure number within the current section
+		bool	fSectionEnd;	///< true when the current section ends with the current measure
+		bool	fEndingSkipped;	///< true when an ending has been skipped in the current measure
+		bool	fRightBarline;	///< true when visiting a right (or default) barline
 		
 		void reset();
+		void startSection();
+		bool played() const;	///< true when the current measure is played
 
 	protected:
 		basevisitor*	fVisitor;
 
 		ctree<xmlelement>::literator	fFirstMeasure;		///< the first measure iterator
+		ctree<xmlelement>::literator	fCurrentMeasure;	///< the current measure iterator
 		ctree<xmlelement>::literator	fForwardRepeat;		///< the forward repeat location
 		ctree<xmlelement>::literator	fEndIterator;		///< indicates the end of to visit
 		ctree<xmlelement>::literator	fNextIterator;		///< indicates the next elt to visit
@@ -90,6 +97,7 @@ class EXP unrolled_xml_tree_browser : public browser<xmlelement>,
 		virtual void visitStart( S_measure& elt);
 		virtual void visitStart( S_ending& elt);
 		virtual void visitStart( S_repeat& elt);
+		virtual void visitStart( S_barline& elt);
 		virtual void visitStart( S_part& elt);
 		virtual void visitStart( S_sound& elt);
 
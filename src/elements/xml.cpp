@@ -16,6 +16,8 @@
 #include <iostream>
 
 #include "xml.h"
+#include "factory.h"
+#include "perfecthash.h"
 #include "visitor.h"
 
 using namespace std;
@@ -23,14 +25,134 @@ using namespace std;
 namespace MusicXML2 
 {
 
+//______________________________________________________________________________
+// xmlname
+//______________________________________________________________________________
+// the attributes names of the MusicXML 2.0 to 3.1 DTDs
+static const char* kAttributeNames[] = {
+	"abbreviated", "accelerate", "additional", "after-barline", "alternate", "approach",
+	"attack", "attribute", "beats", "bezier-offset", "bezier-x", "bezier-y", "blank-page",
+	"bottom-staff", "bracket", "bracket-degrees", "cancel", "cautionary", "coda", "color",
+	"dacapo", "dalsegno", "damper-pedal", "dash-length", "dashed-circle", "default-x",
+	"default-y", "departure", "dir", "direction", "directive", "divisions", "dynamics",
+	"editorial", "element", "elevation", "enclosure", "end-dynamics", "end-length", "fan",
+	"filled", "fine", "first-beat", "font-family", "font-size", "font-style", "font-weight",
+	"forward-repeat", "full-path", "halign", "hand", "height", "id", "implicit", "justify",
+	"last-beat", "letter-spacing", "line", "line-end", "line-height", "line-length",
+	"line-shape", "line-through", "line-type", "location", "long", "make-time", "measure",
+	"media-type", "member-of", "name", "new-page", "new-system", "niente",
+	"non-controlling", "number", "orientation", "overline", "page", "page-number", "pan",
+	"parentheses", "parentheses-degrees", "pizzicato", "placement", "plus-minus", "port",
+	"position", "print-dot", "print-frame", "print-leger", "print-lyric", "print-object",
+	"print-spacing", "reference", "relative-x", "relative-y", "release", "repeater",
+	"rotation", "second-beat", "segno", "separator", "show-frets", "show-number",
+	"show-type", "sign", "size", "slash", "slashes", "smufl", "soft-pedal",
+	"sostenuto-pedal", "sound", "source", "space-length", "spread", "stack-degrees",
+	"staff-spacing", "start-note", "steal-time-following", "steal-time-previous", "string",
+	"substitution", "symbol", "tempo", "text", "text-x", "text-y", "time-only", "times",
+	"tip", "tocoda", "top-staff", "trill-step", "two-note-turn", "type", "underline",
+	"unplayed", "use-dots", "use-stems", "use-symbols", "valign", "value", "version",
+	"width", "winged", "xlink:actuate", "xlink:href", "xlink:role", "xlink:show",
+	"xlink:title", "xlink:type", "xml:lang", "xml:space", "xmlns:xlink"
+};
+
+// the table is built once and never destroyed: it is read without lock
+struct attributesTable {
+	vector<string>	fNames;
+	perfecthash		fIndex;
+	attributesTable() : fNames(kAttributeNames, kAttributeNames + sizeof(kAttributeNames) / sizeof(kAttributeNames[0]))
+						{ fIndex.build (fNames); }
+};
+
+const string& xmlname::empty ()				{ static const string name; return name; }
+
+const string* xmlname::attribute (const string& name)
+{
+	static const attributesTable* table = new attributesTable;
+	int index = table->fIndex.find (name);
+	return (index < 0) ? 0 : &table->fNames[index];
+}
+
+void xmlname::own (const string& name)
+{
+	release();
+	fName = uintptr_t(new string(name)) | 1;
+}
+
+//______________________________________________________________________________
+// modifications stamp
+//______________________________________________________________________________
+// the stamp is given to the nodes of a subtree when it is read at its root: the
+// nodes of the other subtrees (e.g. while parsing) have no stamp to maintain
+void xmlelement::track (const Sxmlstamp& stamp)
+{
+	if (fStamp && (fStamp->fRoot == this) && (fStamp != stamp)) {
+		fStamp->fOuter = stamp;			// an enclosed tracked subtree
+		return;
+	}
+	fStamp = stamp;
+	for (vector<Sxmlattribute>::const_iterator i = fAttributes.begin(); i != fAttributes.end(); i++)
+		(*i)->fStamp = stamp;
+	for (literator i = lbegin(); i != lend(); i++)
+		(*i)->track (stamp);
+}
+
+unsigned long xmlelement::modifications ()
+{
+	if (!fStamp || (fStamp->fRoot != this)) {
+		Sxmlstamp stamp = xmlstamp::create(this);
+		stamp->fOuter = fStamp;
+		fStamp = 0;
+		track (stamp);
+	}
+	return fStamp->fCount;
+}
+
+// the sub elements added using elements() are given the stamp here
+void xmlelement::modified ()
+{
+	fUnsorted = true;
+	if (!fStamp) return;
+	fStamp->changed();
+	for (literator i = lbegin(); i != lend(); i++)
+		if ((*i)->fStamp != fStamp) (*i)->track (fStamp);
+}
+
+void xmlelement::push (const Sxmlelement& elt)
+{
+	elements().push_back(elt);
+	fUnsorted = true;
+	if (fStamp) {
+		fStamp->changed();
+		if (elt->fStamp != fStamp) elt->track (fStamp);
+	}
+}
+
+void xmlelement::push (Sxmlelement&& elt)
+{
+	elements().push_back(std::move(elt));
+	fUnsorted = true;
+	if (fStamp) {
+		fStamp->changed();
+		const Sxmlelement& added = elements().back();
+		if (added->fStamp != fStamp) added->track (fStamp);
+	}
+}
+
 //______________________________________________________________________________
 // xmlattribute
 //______________________________________________________________________________
-Sxmlattribute xmlattribute::create() { xmlattribute * o = new xmlattribute; assert(o!=0); return o; }
+Sxmlattribute xmlattribute::create(arena* a) { xmlattribute * o = a ? new (a) inarena<xmlattribute> : new xmlattribute; assert(o!=0); return o; }
 
 //______________________________________________________________________________
-void xmlattribute::setName (const string& name) 		{ fName = name; }
-void xmlattribute::setValue (const string& value) 		{ fValue = value; }
+void xmlattribute::setName (const string& name)
+{
+	const string* known = xmlname::attribute (name);
+	if (known) fName.share (known);
+	else fName.own (name);
+	changed();
+}
+void xmlattribute::setValue (const string& value) 		{ fValue = value; changed(); }
 
 //______________________________________________________________________________
 void xmlattribute::setValue (long value)
@@ -38,6 +160,7 @@ void xmlattribute::setValue (long value)
 	stringstream s;
 	s << value;
 	s >> fValue;
+	changed();
 }
 
 //______________________________________________________________________________
@@ -46,6 +169,7 @@ void xmlattribute::setValue (int value)
 	stringstream s;
 	s << value;
 	s >> fValue;
+	changed();
 }
 
 //______________________________________________________________________________
@@ -54,6 +178,7 @@ void xmlattribute::setValue (float value)
 	stringstream s;
 	s << value;
 	s >> fValue;
+	changed();
 }
 
 xmlattribute::operator int () const		{ return atoi(fValue.c_str()); }
@@ -63,16 +188,23 @@ xmlattribute::operator float () const	{ return (float)atof(fValue.c_str()); }
 //______________________________________________________________________________
 // xmlelement
 //______________________________________________________________________________
-Sxmlelement xmlelement::create(int lineno)			{ xmlelement * o = new xmlelement(lineno); assert(o!=0); return o; }
+Sxmlelement xmlelement::create(int lineno, arena* a)	{ xmlelement * o = a ? new (a) inarena<xmlelement>(lineno) : new xmlelement(lineno); assert(o!=0); return o; }
 void xmlelement::setValue (int value)				{ setValue((long)value); }
-void xmlelement::setValue (const string& value) 	{ fValue = value; }
-void xmlelement::setName (const string& name) 		{ fName = name; }
+void xmlelement::setValue (const string& value) 	{ fValue = value; changed(); }
+void xmlelement::setName (const string& name)
+{
+	const string* known = factory::instance().name (name);
+	if (known) fName.share (known);
+	else fName.own (name);
+	changed();
+}
 //______________________________________________________________________________
 void xmlelement::setValue (long value)
 {
 	stringstream s;
 	s << value;
 	s >> fValue;
+	changed();
 }
 
 //______________________________________________________________________________
@@ -81,6 +213,7 @@ void xmlelement::setValue (unsigned long value)
 	stringstream s;
 	s << value;
 	s >> fValue;
+	changed();
 }
 
 //______________________________________________________________________________
@@ -89,29 +222,55 @@ void xmlelement::setValue (float value)
 	stringstream s;
 	s << value;
 	s >> fValue;
+	changed();
 }
 
 //______________________________________________________________________________
 long xmlelement::add (const Sxmlattribute& attr)
 { 
 	fAttributes.push_back(attr);
+	if (fStamp) {
+		fStamp->changed();
+		attr->fStamp = fStamp;
+	}
+	return long(fAttributes.size()-1);
+}
+
+long xmlelement::add (Sxmlattribute&& attr)
+{ 
+	fAttributes.push_back(std::move(attr));
+	if (fStamp) {
+		fStamp->changed();
+		fAttributes.back()->fStamp = fStamp;
+	}
 	return long(fAttributes.size()-1);
 }
 
 //______________________________________________________________________________
+// generic elements (not created by the factory) use the kNoElement entry of the visitor cache
+static visitor<Sxmlelement>* genericVisitor (basevisitor& v)
+{
+	basevisitor::interfaces& i = v.dispatch (0);
+	if (!i.fResolved) {
+		i.fGeneric	= dynamic_cast<visitor<Sxmlelement>*>(&v);
+		i.fResolved	= true;
+	}
+	return static_cast<visitor<Sxmlelement>*>(i.fGeneric);
+}
+
 void xmlelement::acceptIn(basevisitor& v) {
-	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
+	visitor<Sxmlelement>* p = genericVisitor (v);
 	if (p) {
-		Sxmlelement xml = this;
+		borrowed<xmlelement>::ref xml (this);
 		p->visitStart (xml);
 	}
 }
 
 //______________________________________________________________________________
 void xmlelement::acceptOut(basevisitor& v) {
-	visitor<Sxmlelement>* p = dynamic_cast<visitor<Sxmlelement>*>(&v);
+	visitor<Sxmlelement>* p = genericVisitor (v);
 	if (p) {
-		Sxmlelement xml = this;
+		borrowed<xmlelement>::ref xml (this);
 		p->visitEnd (xml);
 	}
 }
@@ -195,29 +354,76 @@ ctree<xmlelement>::iterator xmlelement::find(int type, ctree<xmlelement>::iterat
 	return iter;
 }
 
+//______________________________________________________________________________
+borrowed<xmlelement> xmlelement::getSubElement (int type) const
+{
+	// depth first, in document order, as find(type)
+	for (branchs::const_iterator i = elements().begin(); i != elements().end(); i++) {
+		xmlelement* elt = *i;
+		if (elt->getType() == type) return elt;
+		if (!elt->elements().empty()) {
+			borrowed<xmlelement> sub = elt->getSubElement (type);
+			if (sub) return sub;
+		}
+	}
+	return 0;
+}
+
+borrowed<xmlelement> xmlelement::getChild (int type) const
+{
+	for (branchs::const_iterator i = elements().begin(); i != elements().end(); i++)
+		if ((*i)->getType() == type) return (xmlelement*)(*i);
+	return 0;
+}
+
 //______________________________________________________________________________
 const std::string xmlelement::getValue (int subElementType)
 {
-	ctree<xmlelement>::iterator iter = find(subElementType);
-	return (iter != end()) ? (*iter)->getValue() : "";
+	borrowed<xmlelement> elt = getSubElement(subElementType);
+	return elt ? elt->getValue() : "";
 }
 
 int xmlelement::getIntValue (int subElementType, int defaultvalue)
 {
-	ctree<xmlelement>::iterator iter = find(subElementType);
-	return (iter != end()) ? int(*(*iter)) : defaultvalue;
+	borrowed<xmlelement> elt = getSubElement(subElementType);
+	return elt ? int(*elt) : defaultvalue;
 }
 
 long xmlelement::getLongValue (int subElementType, long defaultvalue)
 {
-	ctree<xmlelement>::iterator iter = find(subElementType);
-	return (iter != end()) ? long(*(*iter)) : defaultvalue;
+	borrowed<xmlelement> elt = getSubElement(subElementType);
+	return elt ? long(*elt) : defaultvalue;
 }
 
 float xmlelement::getFloatValue	(int subElementType, float defaultvalue)
 {
-	ctree<xmlelement>::iterator iter = find(subElementType);
-	return (iter != end()) ? float(*(*iter)) : defaultvalue;
+	borrowed<xmlelement> elt = getSubElement(subElementType);
+	return elt ? float(*elt) : defaultvalue;
+}
+
+//______________________________________________________________________________
+const std::string xmlelement::getChildValue (int childType) const
+{
+	borrowed<xmlelement> elt = getChild(childType);
+	return elt ? elt->getValue() : "";
+}
+
+int xmlelement::getChildIntValue (int childType, int defaultvalue) const
+{
+	borrowed<xmlelement> elt = getChild(childType);
+	return elt ? int(*elt) : defaultvalue;
+}
+
+long xmlelement::getChildLongValue (int childType, long defaultvalue) const
+{
+	borrowed<xmlelement> elt = getChild(childType);
+	return elt ? long(*elt) : defaultvalue;
+}
+
+float xmlelement::getChildFloatValue (int childType, float defaultvalue) const
+{
+	borrowed<xmlelement> elt = getChild(childType);
+	return elt ? float(*elt) : defaultvalue;
 }
 
 }
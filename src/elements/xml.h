@@ -13,6 +13,7 @@
 #ifndef __xml__
 #define __xml__
 
+#include <stdint.h>
 #include <string>
 #include <vector>
 
@@ -21,6 +22,7 @@
 #endif
 
 #include "exports.h"
+#include "arena.h"
 #include "ctree.h"
 #include "smartpointer.h"
 
@@ -35,25 +37,99 @@ namespace MusicXML2
 class xmlelement;
 class xmlattribute;
 
+class xmlstamp;
+
 typedef SMARTP<xmlattribute> 	Sxmlattribute;
 typedef SMARTP<xmlelement> 		Sxmlelement;
+typedef SMARTP<xmlstamp> 		Sxmlstamp;
+
+/*!
+\brief the name of an element or an attribute.
+
+	The names of the MusicXML attributes are known at build time: the
+	attributes share them through a static table, which is read without
+	any lock. The elements created by the factory share the name of their
+	type. The other names are owned by their node and released with it.
+*/
+//______________________________________________________________________________
+class EXP xmlname {
+	private:
+		uintptr_t	fName;		///< the name address, with the low bit set when the name is owned
+
+		void	release ()		{ if (fName & 1) delete (std::string*)(fName & ~uintptr_t(1)); }
+
+				 xmlname (const xmlname&);		// not copyable
+		xmlname& operator= (const xmlname&);
+
+	public:
+				 xmlname() : fName(uintptr_t(&empty())) {}
+				~xmlname()	{ release(); }
+
+		//! shares a name that outlives the node
+		void	share (const std::string* name)		{ release(); fName = uintptr_t(name); }
+		//! keeps a copy of name, owned by the node
+		void	own (const std::string& name);
+
+		const std::string& get () const		{ return *(const std::string*)(fName & ~uintptr_t(1)); }
+
+		//! returns the shared copy of a MusicXML attribute name, null for the other names
+		static const std::string* attribute (const std::string& name);
+		//! returns the empty name
+		static const std::string& empty ();
+};
+
+/*!
+\brief a modifications counter shared by the nodes of a subtree
+
+	The nodes of a subtree whose computed data are cached (e.g. a part and its
+	summary, see partsummary::get) share a stamp, which changes with any
+	modification of the subtree (see xmlelement::modifications()).
+	The nodes of the other subtrees have no stamp.
+	The stamp of a tracked subtree enclosed in another one is linked to the
+	enclosing stamp, which changes with it.
+*/
+//______________________________________________________________________________
+class EXP xmlstamp : public smartable {
+	public:
+		const xmlelement*	fRoot;		///< the root of the subtree, compared only
+		Sxmlstamp			fOuter;		///< the stamp of the enclosing tracked subtree
+		unsigned long		fCount;		///< the count of modifications
+
+		static Sxmlstamp create(const xmlelement* root)	{ xmlstamp* o = new xmlstamp(root); assert(o!=0); return o; }
+
+		void changed ()		{ for (xmlstamp* s = this; s; s = s->fOuter) s->fCount++; }
+
+	protected:
+				 xmlstamp(const xmlelement* root) : fRoot(root), fCount(0) {}
+		virtual ~xmlstamp() {}
+};
 
 /*!
 \brief A generic xml attribute representation.
 
 	An attribute is represented by its name and its value.
+	The attributes with the same MusicXML name share the same string
+	(see xmlname).
+	Attributes may be allocated from the arena of a document.
 */
 //______________________________________________________________________________
 class EXP xmlattribute : public smartable {
-	//! the attribute name
-	std::string	fName;
+	friend class xmlelement;
+
+	//! the attribute name (shared or owned)
+	xmlname			fName;
 	//! the attribute value
 	std::string 	fValue;
+	//! the stamp of the tracked subtree that contains the attribute, if any
+	Sxmlstamp		fStamp;
+
+	void changed ()		{ if (fStamp) fStamp->changed(); }
+
     protected:
 		xmlattribute() {}
 		virtual ~xmlattribute() {}
     public:
-		static SMARTP<xmlattribute> create();
+		static SMARTP<xmlattribute> create(arena* a=0);
 
 		void setName (const std::string& name);
 		void setValue (const std::string& value);
@@ -61,7 +137,7 @@ class EXP xmlattribute : public smartable {
 		void setValue (int value);
 		void setValue (float value);
 
-		const std::string& getName () const		{ return fName; }
+		const std::string& getName () const		{ return fName.get(); }
 		//! returns the attribute value as a string
 		const std::string& getValue () const	{ return fValue; }
 		//! returns the attribute value as a int
@@ -79,18 +155,30 @@ class EXP xmlattribute : public smartable {
 	An element is represented by its name, its value,
 	the lists of its attributes and its enclosed elements.
 	Attributes and elements must be added in the required
-	order.
+	order. Elements may be allocated from the arena of a document.
+\n	Element names are not copied: the elements created by the factory
+	share the name of their type, the other names are owned by the element.
 */
 //______________________________________________________________________________
 class EXP xmlelement : public ctree<xmlelement>, public visitable
 {
+	friend class factory;
+	friend class sortvisitor;
+
 	private:
-		//! the element name
-		std::string fName;
+		//! the element name (shared with the factory or owned)
+		xmlname fName;
 		//! the element value
 		std::string fValue;
 		//! list of the element attributes
 		std::vector<Sxmlattribute> fAttributes;
+		//! the stamp of the tracked subtree that contains the element, if any
+		Sxmlstamp fStamp;
+		//! set when the sub elements have changed since the element was last sorted (see sortvisitor)
+		bool fUnsorted;
+
+		void track (const Sxmlstamp& stamp);
+		void changed ()		{ if (fStamp) fStamp->changed(); }
 
 	protected:
 		// the element type
@@ -98,19 +186,30 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		// the input line number for messages to the user
 		int fInputLineNumber;
 
-				 xmlelement (int inputLineNumber) : fType(0), fInputLineNumber(inputLineNumber) {}
+				 xmlelement (int inputLineNumber) : fUnsorted(false), fType(0), fInputLineNumber(inputLineNumber) {}
 		virtual ~xmlelement() {}
 
 	public:
 		typedef ctree<xmlelement>::iterator     iterator;
 
-		static SMARTP<xmlelement> create (int inputLineNumber);
+		static SMARTP<xmlelement> create (int inputLineNumber, arena* a=0);
 
 		virtual void acceptIn  (basevisitor& visitor);
 		virtual void acceptOut (basevisitor& visitor);
 
 		int getInputLineNumber () { return fInputLineNumber; }
 
+		virtual void push (const Sxmlelement& elt);
+		virtual void push (Sxmlelement&& elt);
+		//! notifies a change of the element, to be called after changing its sub elements using elements()
+		virtual void modified ();
+		/*!
+			\brief returns a stamp that changes with any modification of the element subtree
+			The modifications are tracked from the first call on: the subtree nodes share
+			the stamp of the element (see xmlstamp).
+		*/
+		unsigned long modifications ();
+
 		void setValue (unsigned long value);
 		void setValue (long value);
 		void setValue (int value);
@@ -119,7 +218,7 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		void setName  (const std::string& name);
 
 		int                 getType () const    { return fType; }
-		const std::string&  getName () const    { return fName; }
+		const std::string&  getName () const    { return fName.get(); }
 
 		//! returns the element value as a string
 		const std::string& getValue () const    { return fValue; }
@@ -136,6 +235,7 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 
 		//! adds an attribute to the element
 		long add (const Sxmlattribute& attr);
+		long add (Sxmlattribute&& attr);
 
 		// getting information about attributes
 		const std::vector<Sxmlattribute>& attributes() const { return fAttributes; }
@@ -149,12 +249,24 @@ class EXP xmlelement : public ctree<xmlelement>, public visitable
 		ctree<xmlelement>::iterator     find(int type);
 		ctree<xmlelement>::iterator     find(int type, ctree<xmlelement>::iterator start);
 
+		// finding sub elements by type without iterators
+		//! returns the first sub element of a given type in document order, null when none
+		borrowed<xmlelement> getSubElement (int subElementType) const;
+		//! returns the first direct child of a given type, null when none (never descends)
+		borrowed<xmlelement> getChild      (int childType) const;
+
 		// getting sub elements values
 		const std::string getValue      (int subElementType);
 		int               getIntValue   (int subElementType, int defaultvalue);
 		long              getLongValue  (int subElementType, long defaultvalue);
 		float             getFloatValue (int subElementType, float defaultvalue);
 
+		// getting direct children values
+		const std::string getChildValue      (int childType) const;
+		int               getChildIntValue   (int childType, int defaultvalue) const;
+		long              getChildLongValue  (int childType, long defaultvalue) const;
+		float             getChildFloatValue (int childType, float defaultvalue) const;
+
 		// misc
 		bool empty () const	{ return fValue.empty() && elements().empty(); }
 };
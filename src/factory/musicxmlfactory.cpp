@@ -17,7 +17,6 @@
 #include "musicxmlfactory.h"
 #include "factory.h"
 #include "sortvisitor.h"
-#include "xml_tree_browser.h"
 #include "versions.h"
 
 using namespace std;
@@ -332,8 +331,7 @@ void musicxmlfactory::encoding(const char* software)
 void musicxmlfactory::sort()
 {
 	sortvisitor sorter;
-	xml_tree_browser browser(&sorter);
-	browser.browse(*fRoot);
+	sorter.sort (fRoot);
 }
 
 //------------------------------------------------------------------------
@@ -0,0 +1,116 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+
+#ifndef WIN32
+# include <fcntl.h>
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+#include "mappedfile.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+// reads the file into an allocated buffer, used when the file can't be mapped
+// the size of pipes and devices is unknown: the file is read up to its end
+static char* readContent (const char* file, size_t& size)
+{
+	FILE* fd = fopen (file, "rb");
+	if (!fd) return 0;
+	size_t length = 0, capacity = 65536;
+	char* data = (char*)malloc (capacity);
+	while (data) {
+		length += fread (data + length, 1, capacity - length - 2, fd);
+		if (length < capacity - 2) break;		// end of file or error
+		char* grown = (char*)realloc (data, capacity *= 2);
+		if (!grown) free (data);
+		data = grown;
+	}
+	if (data && ferror (fd)) {
+		free (data);
+		data = 0;
+	}
+	fclose (fd);
+	if (data) {
+		data[length] = data[length+1] = 0;
+		size = length;
+	}
+	return data;
+}
+
+//______________________________________________________________________________
+bool mappedfile::mappable (const char* file)
+{
+	struct stat st;
+	return (stat (file, &st) == 0) && ((st.st_mode & S_IFMT) == S_IFREG) && (st.st_size > 0);
+}
+
+//______________________________________________________________________________
+bool mappedfile::open (const char* file)
+{
+	close();
+#ifndef WIN32
+	if (mappable (file)) {
+		int fd = ::open (file, O_RDONLY);
+		if (fd < 0) return false;
+		struct stat st;
+		if ((fstat (fd, &st) == 0) && (st.st_size > 0)) {
+			size_t size = st.st_size;
+			size_t page = sysconf (_SC_PAGESIZE);
+			// the two null bytes come from the zero filled end of the last page
+			// when it has room for them
+			size_t used = size % page;
+			if (used && (used <= page - 2)) {
+				void* data = mmap (0, size + 2, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+				if (data != MAP_FAILED) {
+#ifdef MADV_SEQUENTIAL
+					madvise (data, size + 2, MADV_SEQUENTIAL);
+#endif
+					fData = (char*)data;
+					fSize = size;
+					fLength = size + 2;
+				}
+			}
+		}
+		::close (fd);
+		if (fData) return true;
+	}
+#endif
+	fData = readContent (file, fSize);
+	return fData != 0;
+}
+
+//______________________________________________________________________________
+void mappedfile::close ()
+{
+#ifndef WIN32
+	if (fLength) munmap (fData, fLength);
+	else
+#endif
+	free (fData);
+	fData = 0;
+	fSize = fLength = 0;
+}
+
+}
@@ -0,0 +1,58 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __mappedfile__
+#define __mappedfile__
+
+#include <cstddef>
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief the content of a file in memory, followed by two null bytes
+
+	The file is mapped in memory when possible, using a private mapping:
+	the content can be modified without affecting the file, which is
+	what the parser expects to scan a buffer in place.
+	Otherwise, the file is read into an allocated buffer.
+	Pipes and devices, whose size is unknown, are read up to their end.
+*/
+class EXP mappedfile
+{
+	char*	fData;
+	size_t	fSize;
+	size_t	fLength;	///< the mapped length, 0 when the content is allocated
+
+			 mappedfile (const mappedfile&);	// not copyable
+	mappedfile& operator= (const mappedfile&);
+
+	public:
+				 mappedfile() : fData(0), fSize(0), fLength(0) {}
+		virtual ~mappedfile()	{ close(); }
+
+		bool	open (const char* file);
+		void	close ();
+
+		//! true for the regular files of known size, the ones open() can map
+		static bool mappable (const char* file);
+
+		//! the file content, followed by two null bytes
+		char*	data () const		{ return fData; }
+		size_t	size () const		{ return fSize; }
+		bool	mapped () const		{ return fLength != 0; }
+};
+
+}
+
+#endif
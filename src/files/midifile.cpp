@@ -0,0 +1,274 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <algorithm>
+#include <fstream>
+#include "midifile.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+enum { kNoteOff = 0x80, kNoteOn = 0x90, kControl = 0xb0, kProgram = 0xc0 };
+enum { kBankMSB = 0, kVolume = 7, kBankLSB = 32, kDamper = 64, kSostenuto = 66, kSoft = 67 };
+enum { kDrumsChan = 9 };
+
+static int clip (long val)	{ return val < 0 ? 0 : (val > 127 ? 127 : int(val)); }
+
+//______________________________________________________________________________
+// at a given date, the note off events go first and the note on events last,
+// so that the notes are never cut by their own repetition nor played before
+// their program or control changes
+static int rank (unsigned char status)
+{
+	switch (status & 0xf0) {
+		case kNoteOff:	return 0;
+		case kNoteOn:	return 2;
+		default:		return 1;
+	}
+}
+
+typedef struct {
+	template <typename E> bool operator() (const E& a, const E& b) const {
+		return (a.fDate < b.fDate) || ((a.fDate == b.fDate) && (rank(a.fStatus) < rank(b.fStatus)));
+	}
+} eventorder;
+
+typedef struct {
+	template <typename T> bool operator() (const T& a, const T& b) const { return a.fDate < b.fDate; }
+} tempoorder;
+
+//______________________________________________________________________________
+// low level SMF encoding
+//______________________________________________________________________________
+static void put16 (vector<char>& out, int val)
+{
+	out.push_back (char((val >> 8) & 0xff));
+	out.push_back (char(val & 0xff));
+}
+
+static void put32 (vector<char>& out, unsigned long val)
+{
+	put16 (out, int(val >> 16));
+	put16 (out, int(val & 0xffff));
+}
+
+// a variable length quantity
+static void putvar (vector<char>& out, unsigned long val)
+{
+	unsigned char buff[5];
+	int n = 0;
+	buff[n++] = val & 0x7f;
+	while (val >>= 7)
+		buff[n++] = (val & 0x7f) | 0x80;
+	while (n) out.push_back (char(buff[--n]));
+}
+
+static void putmeta (vector<char>& out, unsigned long delta, int type, const string& data)
+{
+	putvar (out, delta);
+	out.push_back (char(0xff));
+	out.push_back (char(type));
+	putvar (out, data.size());
+	out.insert (out.end(), data.begin(), data.end());
+}
+
+static void puttrack (ostream& out, const vector<char>& data)
+{
+	vector<char> header;
+	header.push_back('M'); header.push_back('T'); header.push_back('r'); header.push_back('k');
+	put32 (header, data.size());
+	out.write (&header[0], header.size());
+	if (data.size()) out.write (&data[0], data.size());
+}
+
+//______________________________________________________________________________
+// midifile
+//______________________________________________________________________________
+midifile::track& midifile::current ()
+{
+	if (fTracks.empty()) startPart (0);
+	return fTracks.back();
+}
+
+//______________________________________________________________________________
+// the MusicXML channels are in the range 1 - 16, the parts that don't specify
+// a valid channel use their default channel
+int midifile::channel (int chan)
+{
+	track& t = current();
+	if ((chan >= 1) && (chan <= 16))
+		t.fChan = chan - 1;
+	return t.fChan;
+}
+
+//______________________________________________________________________________
+void midifile::add (long date, int status, int data1, int data2)
+{
+	event e;
+	e.fDate = (unsigned int)(date < 0 ? 0 : date);
+	e.fStatus = (unsigned char)status;
+	e.fData1 = (unsigned char)clip(data1);
+	e.fData2 = (unsigned char)clip(data2);
+	current().fEvents.push_back (e);
+}
+
+//______________________________________________________________________________
+void midifile::startPart (int instrCount)
+{
+	track t;
+	// each part has a default channel of its own, the percussion channel is skipped
+	int chan = int(fTracks.size()) % 15;
+	t.fChan = (chan >= kDrumsChan) ? chan + 1 : chan;
+	t.fEnd = 0;
+	fTracks.push_back (t);
+}
+
+void midifile::newInstrument (std::string instrName, int chan)
+{
+	track& t = current();
+	if (t.fName.empty()) t.fName = instrName;
+	channel (chan);
+}
+
+void midifile::endPart (long date)
+{
+	track& t = current();
+	if (date > t.fEnd) t.fEnd = date;
+}
+
+//______________________________________________________________________________
+void midifile::newNote (long date, int chan, float pitch, int velocity, int duration)
+{
+	if (date < 0) {				// the part of the note before the score start is dropped
+		duration += date;
+		date = 0;
+	}
+	if (duration <= 0) return;
+	int c = channel (chan);
+	int key = clip(long(pitch + 0.5f));
+	int vel = velocity < 1 ? 1 : clip(velocity);
+	add (date, kNoteOn | c, key, vel);
+	add (date + duration, kNoteOff | c, key, 64);
+	fNotes++;
+}
+
+void midifile::tempoChange (long date, int bpm)
+{
+	if (bpm <= 0) return;
+	tempo t;
+	t.fDate = (unsigned int)(date < 0 ? 0 : date);
+	t.fTempo = 60000000 / bpm;
+	fTempo.push_back (t);
+}
+
+void midifile::pedalChange (long date, pedalType t, int value)
+{
+	int ctrl = kDamper;
+	if (t == kSoftpedal) ctrl = kSoft;
+	else if (t == kSostenutoPedal) ctrl = kSostenuto;
+	add (date, kControl | current().fChan, ctrl, value);
+}
+
+//______________________________________________________________________________
+// volume is expressed as a percentage, bank and program numbers start at 1
+void midifile::volChange (long date, int chan, int vol)
+{
+	add (date, kControl | channel(chan), kVolume, (vol * 127) / 100);
+}
+
+void midifile::bankChange (long date, int chan, int bank)
+{
+	int c = channel(chan);
+	bank--;
+	add (date, kControl | c, kBankMSB, (bank >> 7) & 0x7f);
+	add (date, kControl | c, kBankLSB, bank & 0x7f);
+}
+
+void midifile::progChange (long date, int chan, int prog)
+{
+	add (date, kProgram | channel(chan), prog - 1);
+}
+
+//______________________________________________________________________________
+// SMF writing
+//______________________________________________________________________________
+void midifile::write (ostream& out) const
+{
+	vector<char> data;
+	data.push_back('M'); data.push_back('T'); data.push_back('h'); data.push_back('d');
+	put32 (data, 6);
+	put16 (data, 1);							// format 1
+	put16 (data, countTracks());
+	put16 (data, int(fTPQ & 0x7fff));			// ticks per quarter note
+	out.write (&data[0], data.size());
+
+	// the conductor track: the parts share the same tempo changes,
+	// only the first tempo of a given date is kept
+	vector<tempo> tempi (fTempo);
+	stable_sort (tempi.begin(), tempi.end(), tempoorder());
+	data.clear();
+	unsigned long date = 0;
+	for (size_t i = 0; i < tempi.size(); i++) {
+		if (i && (tempi[i].fDate == tempi[i-1].fDate)) continue;
+		string value (3, 0);
+		value[0] = char((tempi[i].fTempo >> 16) & 0xff);
+		value[1] = char((tempi[i].fTempo >> 8) & 0xff);
+		value[2] = char(tempi[i].fTempo & 0xff);
+		putmeta (data, tempi[i].fDate - date, 0x51, value);
+		date = tempi[i].fDate;
+	}
+	putmeta (data, 0, 0x2f, "");
+	puttrack (out, data);
+
+	// the parts tracks
+	vector<event> events;
+	for (vector<track>::const_iterator t = fTracks.begin(); t != fTracks.end(); t++) {
+		events = t->fEvents;
+		stable_sort (events.begin(), events.end(), eventorder());
+
+		data.clear();
+		data.reserve (events.size() * 4 + t->fName.size() + 16);
+		if (!t->fName.empty()) putmeta (data, 0, 0x03, t->fName);
+		int status = 0;							// running status
+		date = 0;
+		for (vector<event>::const_iterator e = events.begin(); e != events.end(); e++) {
+			putvar (data, e->fDate - date);
+			if (e->fStatus != status) {
+				status = e->fStatus;
+				data.push_back (char(status));
+			}
+			data.push_back (char(e->fData1));
+			if ((status & 0xf0) != kProgram) data.push_back (char(e->fData2));
+			date = e->fDate;
+		}
+		unsigned long end = t->fEnd > 0 ? (unsigned long)t->fEnd : 0;
+		putmeta (data, end > date ? end - date : 0, 0x2f, "");
+		puttrack (out, data);
+	}
+}
+
+//______________________________________________________________________________
+bool midifile::write (const char* file) const
+{
+	ofstream out (file, ios::out | ios::binary);
+	if (!out.is_open()) return false;
+	write (out);
+	return out.good();
+}
+
+}
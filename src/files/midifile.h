@@ -0,0 +1,104 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __midifile__
+#define __midifile__
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "exports.h"
+#include "midicontextvisitor.h"
+
+namespace MusicXML2
+{
+
+/*!
+\addtogroup files
+@{
+*/
+
+//______________________________________________________________________________
+/*!
+\brief a midiwriter that collects the events and writes a Standard MIDI File
+
+	The events are collected in compact form (8 bytes per event), one track per part.
+	The notes are stored as note on / note off pairs.
+	write() produces a type 1 file: the first track holds the tempo changes,
+	the next ones hold the parts events.
+\n	The MusicXML channels (1 to 16) are mapped to MIDI channels 0 to 15. Parts
+	that don't specify a channel use a channel of their own (the percussion
+	channel excepted).
+*/
+class EXP midifile : public midiwriter
+{
+	typedef struct {
+		unsigned int	fDate;		///< the event date in ticks
+		unsigned char	fStatus;	///< the MIDI status byte
+		unsigned char	fData1;
+		unsigned char	fData2;
+	} event;
+
+	typedef struct {
+		unsigned int	fDate;
+		unsigned int	fTempo;		///< microseconds per quarter note
+	} tempo;
+
+	typedef struct {
+		std::string			fName;		///< the track name (the first instrument name)
+		std::vector<event>	fEvents;
+		long				fEnd;		///< the end of track date
+		int					fChan;		///< the current MIDI channel of the part
+	} track;
+
+	long				fTPQ;
+	std::vector<track>	fTracks;
+	std::vector<tempo>	fTempo;		///< the tempo track content
+	long				fNotes;
+
+	track&	current ();
+	int		channel (int chan);
+	void	add (long date, int status, int data1, int data2=0);
+
+	public:
+				 midifile(long tpq=480) : fTPQ(tpq), fNotes(0) {}
+		virtual ~midifile() {}
+
+		void	clear ()				{ fTracks.clear(); fTempo.clear(); fNotes = 0; }
+		long	tpq () const			{ return fTPQ; }
+		long	countNotes () const		{ return fNotes; }
+		int		countTracks () const	{ return int(fTracks.size()) + 1; }
+
+		//! writes a type 1 Standard MIDI File, out should be a binary stream
+		void	write (std::ostream& out) const;
+		//! writes a type 1 Standard MIDI File, returns false when the file can't be written
+		bool	write (const char* file) const;
+
+		// the midiwriter interface
+		virtual void startPart (int instrCount);
+		virtual void newInstrument (std::string instrName, int chan=-1);
+		virtual void endPart (long date);
+
+		virtual void newNote (long date, int chan, float pitch, int velocity, int duration);
+		virtual void tempoChange (long date, int bpm);
+		virtual void pedalChange (long date, pedalType t, int value);
+
+		virtual void volChange (long date, int chan, int vol);
+		virtual void bankChange (long date, int chan, int bank);
+		virtual void progChange (long date, int chan, int prog);
+};
+
+/*! @} */
+
+}
+
+#endif
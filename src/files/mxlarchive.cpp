@@ -0,0 +1,190 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <string.h>
+#include <new>
+
+#include "inflate.h"
+#include "mxlarchive.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+enum {
+	kLocalHeaderSig	= 0x04034b50,
+	kCentralDirSig	= 0x02014b50,
+	kEndOfDirSig	= 0x06054b50,
+	kLocalHeaderSize = 30,
+	kCentralDirSize	= 46,
+	kEndOfDirSize	= 22
+};
+
+enum {
+	kZip64Marker	= 0xffffffff,		// the 32 bits sizes and offsets of a zip64 entry
+	kMaxDeflateRatio = 1032,			// the maximum compression ratio of deflate
+	kMaxEntrySize	= 256 * 1024 * 1024	// the largest document that is extracted
+};
+
+static const char* kContainer = "META-INF/container.xml";
+
+// little endian reads
+static unsigned int get16 (const unsigned char* p)		{ return p[0] | (p[1] << 8); }
+static unsigned long get32 (const unsigned char* p)		{ return p[0] | (p[1] << 8) | (p[2] << 16) | ((unsigned long)p[3] << 24); }
+
+//______________________________________________________________________________
+bool mxlarchive::open (const char* file)
+{
+	return fFile.open (file) && open (fFile.data(), fFile.size());
+}
+
+//______________________________________________________________________________
+bool mxlarchive::open (const char* data, size_t size)
+{
+	fData = (const unsigned char*)data;
+	fSize = size;
+	fEntries.clear();
+	return readDirectory();
+}
+
+//______________________________________________________________________________
+// reads the central directory, located by the end of central directory record
+// which is at the end of the archive, possibly followed by a comment
+bool mxlarchive::readDirectory ()
+{
+	if (!fData || (fSize < kEndOfDirSize)) return false;
+	size_t pos = fSize - kEndOfDirSize;
+	size_t limit = (pos > 0xffff) ? pos - 0xffff : 0;
+	while (get32 (fData + pos) != kEndOfDirSig) {
+		if (pos == limit) return false;
+		pos--;
+	}
+	const unsigned char* end = fData + pos;
+	size_t count = get16 (end + 10);
+	size_t dirOffset = get32 (end + 16);
+
+	pos = dirOffset;
+	for (size_t i = 0; i < count; i++) {
+		if ((pos + kCentralDirSize > fSize) || (get32 (fData + pos) != kCentralDirSig)) return false;
+		const unsigned char* p = fData + pos;
+		size_t nameLen = get16 (p + 28);
+		size_t skip = kCentralDirSize + nameLen + get16 (p + 30) + get16 (p + 32);
+		if (pos + skip > fSize) return false;
+
+		entry e;
+		e.fMethod = get16 (p + 10);
+		e.fCrc = get32 (p + 16);
+		e.fCompressedSize = get32 (p + 20);
+		e.fSize = get32 (p + 24);
+		e.fOffset = get32 (p + 42);
+		e.fName.assign ((const char*)p + kCentralDirSize, nameLen);
+		fEntries.push_back (e);
+		pos += skip;
+	}
+	return true;
+}
+
+//______________________________________________________________________________
+const mxlarchive::entry* mxlarchive::find (const string& name) const
+{
+	for (size_t i = 0; i < fEntries.size(); i++)
+		if (fEntries[i].fName == name) return &fEntries[i];
+	return 0;
+}
+
+//______________________________________________________________________________
+bool mxlarchive::extract (const string& name, vector<char>& out) const
+{
+	const entry* e = find (name);
+	if (!e) return false;
+
+	size_t pos = e->fOffset;
+	if ((pos + kLocalHeaderSize > fSize) || (get32 (fData + pos) != kLocalHeaderSig)) return false;
+	pos += kLocalHeaderSize + get16 (fData + pos + 26) + get16 (fData + pos + 28);
+	if (pos + e->fCompressedSize > fSize) return false;
+	const unsigned char* data = fData + pos;
+
+	// the uncompressed size is read from the archive: it is checked before allocating
+	if ((e->fSize == kZip64Marker) || (e->fCompressedSize == kZip64Marker) || (e->fOffset == kZip64Marker))
+		return false;
+	if (e->fSize > kMaxEntrySize) return false;
+	if ((e->fMethod == 0) && (e->fCompressedSize != e->fSize)) return false;
+	if ((e->fMethod == 8) && (e->fSize > e->fCompressedSize * kMaxDeflateRatio)) return false;
+
+	try {
+		out.resize (e->fSize + 2);
+	}
+	catch (std::bad_alloc&) {
+		out.clear();
+		return false;
+	}
+	unsigned char* dst = (unsigned char*)&out[0];
+	switch (e->fMethod) {
+		case 0:
+			memcpy (dst, data, e->fSize);
+			break;
+		case 8:
+			if (!inflater::inflate (data, e->fCompressedSize, dst, e->fSize)) return false;
+			break;
+		default:
+			return false;
+	}
+	if (inflater::crc32 (dst, e->fSize) != e->fCrc) return false;
+	out[e->fSize] = out[e->fSize + 1] = 0;
+	return true;
+}
+
+//______________________________________________________________________________
+// looks for the full-path attribute of the first rootfile element of the container
+static string rootfilePath (const char* container)
+{
+	const char* ptr = container;
+	while ((ptr = strstr (ptr, "<rootfile"))) {
+		ptr += 9;
+		if ((*ptr == ' ') || (*ptr == '\t') || (*ptr == '\r') || (*ptr == '\n')) break;
+	}
+	if (!ptr) return "";
+
+	const char* end = strchr (ptr, '>');
+	const char* attr = strstr (ptr, "full-path");
+	if (!attr || (end && (attr > end))) return "";
+	attr += 9;
+	while ((*attr == ' ') || (*attr == '=')) attr++;
+	char quote = *attr++;
+	if ((quote != '"') && (quote != '\'')) return "";
+	const char* close = strchr (attr, quote);
+	return close ? string (attr, close - attr) : "";
+}
+
+//______________________________________________________________________________
+string mxlarchive::rootfile () const
+{
+	vector<char> container;
+	if (extract (kContainer, container)) {
+		string path = rootfilePath (&container[0]);
+		if (path.size() && find (path)) return path;
+	}
+	// no usable container: looks for a single xml document outside META-INF
+	for (size_t i = 0; i < fEntries.size(); i++) {
+		const string& name = fEntries[i].fName;
+		if ((name.size() > 4) && (name.compare (name.size() - 4, 4, ".xml") == 0) && name.compare (0, 9, "META-INF/"))
+			return name;
+	}
+	return "";
+}
+
+}
@@ -0,0 +1,81 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __mxlarchive__
+#define __mxlarchive__
+
+#include <string>
+#include <vector>
+#include "exports.h"
+#include "mappedfile.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a compressed MusicXML file (.mxl)
+
+	A compressed MusicXML file is a zip archive. The MusicXML document
+	is designated by the first rootfile of META-INF/container.xml.
+	Entries are stored or deflate compressed.
+\n	Zip64 archives are not supported: their entries are rejected.
+	The entries sizes are checked before extraction: a deflated entry can't
+	be larger than 1032 times its compressed size, and the extracted
+	entries are limited to 256 MB.
+*/
+class EXP mxlarchive
+{
+	public:
+		struct entry {
+			std::string		fName;
+			int				fMethod;		///< the compression method: 0 (stored) or 8 (deflate)
+			unsigned long	fCrc;
+			size_t			fCompressedSize;
+			size_t			fSize;
+			size_t			fOffset;		///< the offset of the local header
+		};
+
+	private:
+		mappedfile				fFile;		///< the archive content when read from a file
+		const unsigned char*	fData;		///< the archive data
+		size_t					fSize;
+		std::vector<entry>		fEntries;
+
+		bool			readDirectory ();
+		const entry*	find (const std::string& name) const;
+
+	public:
+				 mxlarchive() : fData(0), fSize(0) {}
+		virtual ~mxlarchive() {}
+
+		//! reads an archive from a file
+		bool	open (const char* file);
+		//! uses an archive in memory: the data are not copied and must remain valid
+		bool	open (const char* data, size_t size);
+
+		const std::vector<entry>&	entries () const	{ return fEntries; }
+
+		//! gives the name of the MusicXML document, an empty string when not found
+		std::string	rootfile () const;
+
+		/*! \brief decompresses an entry
+			\param name the entry name
+			\param out on output, the entry content followed by two null bytes,
+			as expected by the parser to scan a buffer in place
+			\return false when the entry is missing, corrupted, too large or can't be allocated
+		*/
+		bool	extract (const std::string& name, std::vector<char>& out) const;
+};
+
+}
+
+#endif
@@ -0,0 +1,184 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <string.h>
+#include "partindex.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+static bool startswith (const char* p, const char* end, const char* str)
+{
+	size_t n = strlen(str);
+	return (size_t(end - p) >= n) && !strncmp(p, str, n);
+}
+
+// gives the location following str or 0 when not found
+static const char* skipto (const char* p, const char* end, const char* str)
+{
+	size_t n = strlen(str);
+	while ((p = (const char*)memchr(p, str[0], end - p))) {
+		if (size_t(end - p) < n) return 0;
+		if (!strncmp(p, str, n)) return p + n;
+		p++;
+	}
+	return 0;
+}
+
+static bool blank (char c)	{ return (c == ' ') || (c == '\t') || (c == '\n') || (c == '\r'); }
+
+// gives the end of a tag name
+static const char* nameend (const char* p, const char* end)
+{
+	while ((p < end) && !blank(*p) && (*p != '/') && (*p != '>')) p++;
+	return p;
+}
+
+// gives the closing '>' of a tag, skipping the quoted attributes values
+static const char* tagend (const char* p, const char* end)
+{
+	char quote = 0;
+	for (; p < end; p++) {
+		if (quote) { if (*p == quote) quote = 0; }
+		else if ((*p == '"') || (*p == '\'')) quote = *p;
+		else if (*p == '>') return p;
+	}
+	return 0;
+}
+
+// gives the value of the "id" attribute of a tag
+static string idattribute (const char* p, const char* end)
+{
+	while (p < end) {
+		while ((p < end) && blank(*p)) p++;
+		const char* name = p;
+		while ((p < end) && (*p != '=') && !blank(*p) && (*p != '/')) p++;
+		size_t namelen = p - name;
+		while ((p < end) && blank(*p)) p++;
+		if ((p >= end) || (*p != '=')) return "";
+		p++;
+		while ((p < end) && blank(*p)) p++;
+		if ((p >= end) || ((*p != '"') && (*p != '\''))) return "";
+		const char* value = p + 1;
+		const char* valueend = (const char*)memchr(value, *p, end - value);
+		if (!valueend) return "";
+		if ((namelen == 2) && !strncmp(name, "id", 2)) return string(value, valueend - value);
+		p = valueend + 1;
+	}
+	return "";
+}
+
+//______________________________________________________________________________
+// the document tags are scanned to track the depth of the elements: the parts
+// are the 'part' elements at depth 1 in a 'score-partwise' root element
+bool partindex::build (const char* buffer, size_t size)
+{
+	clear();
+	const char* p = buffer;
+	const char* end = buffer + size;
+	const char* partstart = 0;		// the start of the current part
+	string partID;
+	int depth = 0;
+
+	while ((p = (const char*)memchr(p, '<', end - p))) {
+		const char* tag = p;
+		if (startswith(p, end, "<!--"))				p = skipto (p + 4, end, "-->");
+		else if (startswith(p, end, "<![CDATA["))	p = skipto (p + 9, end, "]]>");
+		else if (startswith(p, end, "<?"))			p = skipto (p + 2, end, "?>");
+		else if (startswith(p, end, "<!")) {		// doctype, possibly with an internal subset
+			const char* subset = (const char*)memchr(p, '[', end - p);
+			const char* close = tagend (p, end);
+			if (subset && close && (subset < close)) {
+				p = skipto (subset, end, "]");
+				if (p) p = tagend (p, end);
+			}
+			else p = close;
+			if (p) p++;
+		}
+		else {
+			bool closing = (p[1] == '/');
+			const char* name = p + (closing ? 2 : 1);
+			const char* nend = nameend (name, end);
+			const char* close = tagend (nend, end);
+			if (!close) return false;
+			size_t namelen = nend - name;
+			bool ispart = (namelen == 4) && !strncmp(name, "part", 4);
+
+			if (closing) {
+				depth--;
+				if ((depth == 1) && partstart && ispart) {
+					part tmp = { partID, size_t(partstart - buffer), size_t(close + 1 - buffer) };
+					fParts.push_back (tmp);
+					partstart = 0;
+				}
+				else if (depth == 0) {
+					fSize = size;
+					fValid = true;
+					return true;
+				}
+				else if (depth < 0) return false;
+			}
+			else {
+				bool empty = (close[-1] == '/');
+				if (depth == 0) {
+					if ((namelen != 14) || strncmp(name, "score-partwise", 14)) return false;
+				}
+				else if ((depth == 1) && ispart) {
+					partID = idattribute (nend, empty ? close - 1 : close);
+					if (empty) {
+						part tmp = { partID, size_t(tag - buffer), size_t(close + 1 - buffer) };
+						fParts.push_back (tmp);
+					}
+					else partstart = tag;
+				}
+				if (!empty) depth++;
+			}
+			p = close + 1;
+		}
+		if (!p) return false;
+	}
+	return false;
+}
+
+//______________________________________________________________________________
+int partindex::find (const string& id) const
+{
+	for (size_t i = 0; i < fParts.size(); i++)
+		if (fParts[i].fID == id) return int(i);
+	return -1;
+}
+
+//______________________________________________________________________________
+bool partindex::extract (const char* buffer, int index, vector<char>& doc) const
+{
+	if (!fValid) return false;
+	size_t header = fParts.size() ? fParts.front().fBegin : fSize;
+	size_t trailer = fParts.size() ? fParts.back().fEnd : fSize;
+	const part* p = ((index >= 0) && (index < size())) ? &fParts[index] : 0;
+	doc.clear();
+	doc.reserve (header + (p ? p->fEnd - p->fBegin : 0) + (fSize - trailer) + 2);
+	doc.insert (doc.end(), buffer, buffer + header);
+	if (p) doc.insert (doc.end(), buffer + p->fBegin, buffer + p->fEnd);
+	doc.insert (doc.end(), buffer + trailer, buffer + fSize);
+	doc.push_back (0);
+	doc.push_back (0);
+	return true;
+}
+
+}
@@ -0,0 +1,75 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __partindex__
+#define __partindex__
+
+#include <string>
+#include <vector>
+#include <cstddef>
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief the byte offsets of the parts of a score-partwise document
+
+	The index is built by a scan of the document tags, without parsing:
+	it gives the location of each part element and allows to read a
+	document reduced to its header (including the part-list), one part
+	and its trailer. An index can be kept with its document and reused
+	to read the parts one at a time.
+\n	The index is invalid for the score-timewise documents and for the
+	documents that can't be scanned (e.g. utf16 documents).
+*/
+class EXP partindex
+{
+	typedef struct {
+		std::string	fID;
+		size_t		fBegin;		///< offset of the part start tag
+		size_t		fEnd;		///< offset following the part end tag
+	} part;
+
+	std::vector<part>	fParts;
+	size_t				fSize;		///< the document size
+	bool				fValid;
+
+	public:
+				 partindex() : fSize(0), fValid(false) {}
+				 partindex(const char* buffer, size_t size) : fSize(0), fValid(false) { build (buffer, size); }
+		virtual ~partindex() {}
+
+		//! scans a document, returns false when the document can't be indexed
+		bool	build (const char* buffer, size_t size);
+		void	clear ()			{ fParts.clear(); fSize = 0; fValid = false; }
+
+		bool				valid () const			{ return fValid; }
+		int					size () const			{ return int(fParts.size()); }
+		const std::string&	id (int index) const	{ return fParts[index].fID; }
+		//! gives the index of a part or -1 when the part is not found
+		int					find (const std::string& id) const;
+
+		/*!
+			\brief builds a document reduced to its header, a part and its trailer
+			\param buffer the indexed document
+			\param index the part index, no part is kept when out of range
+			\param doc on output, the reduced document followed by two null bytes (see xmlreader::readinplace)
+			\return false when the index is invalid
+		*/
+		bool	extract (const char* buffer, int index, std::vector<char>& doc) const;
+};
+
+}
+
+#endif
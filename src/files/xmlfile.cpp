@@ -12,8 +12,7 @@
 
 #include <iostream>
 #include "xmlfile.h"
-#include "xmlvisitor.h"
-#include "tree_browser.h"
+#include "xmlwriter.h"
 
 using namespace std; 
 using namespace MusicXML2; 
@@ -21,7 +20,7 @@ namespace MusicXML2
 {
 
 //______________________________________________________________________________
-SXMLFile TXMLFile::create ()  { TXMLFile* o = new TXMLFile; assert(o!=0); return o; }
+SXMLFile TXMLFile::create (bool useArena)  { TXMLFile* o = new TXMLFile(useArena); assert(o!=0); return o; }
 
 //______________________________________________________________________________
 TDocType::TDocType (const string start) : fStartElement(start), fPublic(true) 
@@ -54,13 +53,18 @@ void TXMLDecl::print (ostream& s)
 }
 
 //______________________________________________________________________________
-void TXMLFile::print (ostream& stream) 
+void TXMLFile::print (ostream& stream, bool compact) 
 {
-	if (fXMLDecl) fXMLDecl->print(stream);
-	if (fDocType) fDocType->print(stream);
-	xmlvisitor v(stream);
-	tree_browser<xmlelement> browser(&v);
-	browser.browse(*elements());
+	xmlwriter w(stream, compact);
+	w.write (*this);
+}
+
+//______________________________________________________________________________
+bool TXMLFile::print (int fd, bool compact) 
+{
+	xmlwriter w(fd, compact);
+	w.write (*this);
+	return w.flush();
 }
 
 }
@@ -72,24 +72,30 @@ class EXP TXMLFile : public smartable
     TXMLDecl*             fXMLDecl;
     TDocType*             fDocType;
     Sxmlelement           fXMLTree;
+    Sarena                fArena;		// the optional arena for the document nodes
   
   protected:
-			 TXMLFile () : fXMLDecl(0), fDocType(0) {}
+			 TXMLFile (bool useArena) : fXMLDecl(0), fDocType(0) { if (useArena) fArena = arena::create(); }
     virtual ~TXMLFile () { delete fXMLDecl; delete fDocType; }
     
   public:
-    static SMARTP<TXMLFile> create();
+    static SMARTP<TXMLFile> create(bool useArena=false);
 
   public:
     TXMLDecl* 		getXMLDecl ()			{ return fXMLDecl; }
     TDocType* 		getDocType ()			{ return fDocType; }
     Sxmlelement		elements () 			{ return fXMLTree; }
+    //! the arena to allocate the document nodes from, null when the document has no arena
+    arena*			getArena ()				{ return fArena; }
 
     void 			set (Sxmlelement root)	{ fXMLTree = root; }
     void 			set (TXMLDecl * dec)	{ fXMLDecl = dec; }
     void 			set (TDocType * dt)		{ fDocType = dt; }
 
-    void 			print (std::ostream& s);
+    //! prints the document, the compact form has no whitespace between the elements
+    void 			print (std::ostream& s, bool compact=false);
+    //! writes the document to a file descriptor, returns false in case of write error
+    bool 			print (int fd, bool compact=false);
 };
 typedef SMARTP<TXMLFile> SXMLFile;
 
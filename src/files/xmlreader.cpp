@@ -15,7 +15,13 @@
 #endif
 
 #include <iostream>
+#include <string.h>
+#include <vector>
+#include "mappedfile.h"
+#include "mxlarchive.h"
+#include "partindex.h"
 #include "xmlreader.h"
+#include "elements.h"
 #include "factory.h"
 
 using namespace std;
@@ -27,6 +33,7 @@ extern "C" {
 bool readfile   (const char * file, reader * r);
 bool readstream (FILE * file, reader * r);
 bool readbuffer (const char * buffer, reader * r);
+bool readinplace (char * buffer, size_t size, reader * r);
 }
 
 #if 0
@@ -35,62 +42,149 @@ bool readbuffer (const char * buffer, reader * r);
 #define debug(str,val)
 #endif
 
+//_______________________________________________________________________________
+SXMLFile xmlreader::newFile()
+{
+	fFile = TXMLFile::create(fUseArena);
+	fArena = fFile->getArena();
+	fStack = std::stack<borrowed<xmlelement> >();	// drops the state of a previous failed read
+	return fFile;
+}
+
 //_______________________________________________________________________________
 SXMLFile xmlreader::readbuff(const char* buffer)
 {
-	fFile = TXMLFile::create();
+	newFile();
 	debug("read buffer", '-');
 	return readbuffer (buffer, this) ? fFile : 0;
 }
 
 //_______________________________________________________________________________
+// the file content is mapped in memory and scanned in place
+// utf16 files, pipes and devices are read by the stream input
 SXMLFile xmlreader::read(const char* file)
 {
-	fFile = TXMLFile::create();
 	debug("read", file);
-	return readfile (file, this) ? fFile : 0;
+	if (!mappedfile::mappable (file)) {
+		newFile();
+		return readfile (file, this) ? fFile : 0;
+	}
+	mappedfile content;
+	if (!content.open (file)) {
+		newFile();
+		cerr << "can't open file " << file << endl;
+		return 0;
+	}
+	unsigned char first = content.size() ? content.data()[0] : 0;
+	if ((first == 0xff) || (first == 0xfe)) {
+		newFile();
+		return readfile (file, this) ? fFile : 0;
+	}
+	return readinplace (content.data(), content.size());
 }
 
 //_______________________________________________________________________________
 SXMLFile xmlreader::read(FILE* file)
 {
-	fFile = TXMLFile::create();
+	newFile();
 	return readstream (file, this) ? fFile : 0;
 }
 
+//_______________________________________________________________________________
+SXMLFile xmlreader::readinplace(char* buffer, size_t size)
+{
+	newFile();
+	return MusicXML2::readinplace (buffer, size, this) ? fFile : 0;
+}
+
+//_______________________________________________________________________________
+// the document is reduced to its header, the part and its trailer, which is parsed in place
+SXMLFile xmlreader::readpart(const char* buffer, const string& id, const partindex* index)
+{
+	partindex local;
+	if (!index) {
+		local.build (buffer, strlen(buffer));
+		index = &local;
+	}
+	vector<char> doc;
+	if (!index->extract (buffer, index->find (id), doc))
+		return readbuff (buffer);
+	return readinplace (&doc[0], doc.size() - 2);
+}
+
+//_______________________________________________________________________________
+// the MusicXML document is inflated into a buffer which is parsed in place
+SXMLFile xmlreader::readmxl(mxlarchive& archive)
+{
+	vector<char> buffer;
+	string name = archive.rootfile();
+	if (name.empty()) {
+		cerr << "can't find a MusicXML document in the archive" << endl;
+		return 0;
+	}
+	if (!archive.extract (name, buffer)) {
+		cerr << "can't read " << name << " in the archive" << endl;
+		return 0;
+	}
+	return readinplace (&buffer[0], buffer.size() - 2);
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readmxl(const char* file)
+{
+	mxlarchive archive;
+	if (!archive.open (file)) {
+		cerr << "can't open compressed file " << file << endl;
+		return 0;
+	}
+	return readmxl (archive);
+}
+
+//_______________________________________________________________________________
+SXMLFile xmlreader::readmxl(const char* data, size_t size)
+{
+	mxlarchive archive;
+	if (!archive.open (data, size)) {
+		cerr << "invalid compressed MusicXML data" << endl;
+		return 0;
+	}
+	return readmxl (archive);
+}
+
 //_______________________________________________________________________________
 void xmlreader::newComment (const char* comment)
 {
-	Sxmlelement elt = factory::instance().create("comment");
+	Sxmlelement elt = factory::instance().create(kComment, getInputLineNumber(), fArena);
 	elt->setValue(comment);
 	// comments outside the xml hierarchy are lost
-	if (fStack.size()) fStack.top()->push(elt);
+	if (fStack.size()) fStack.top()->push(std::move(elt));
 }
 
 //_______________________________________________________________________________
 void xmlreader::newProcessingInstruction (const char* pi)
 {
-	Sxmlelement elt = factory::instance().create("pi");
+	Sxmlelement elt = factory::instance().create(kProcessingInstruction, getInputLineNumber(), fArena);
 	elt->setValue(pi);
 	// processing instructions outside the xml hierarchy are lost
-	if (fStack.size()) fStack.top()->push(elt);
+	if (fStack.size()) fStack.top()->push(std::move(elt));
 }
 
 //_______________________________________________________________________________
 bool xmlreader::newElement (const char* eltName)
 {
 	debug("newElement", eltName);
-	Sxmlelement elt = factory::instance().create(eltName);
+	Sxmlelement elt = factory::instance().create(eltName, getInputLineNumber(), fArena);
 	if (!elt) return false;
+	borrowed<xmlelement> current = elt;
 	if (!fFile->elements()) {
 	debug("first element", eltName);
 		fFile->set(elt);
 	}
 	else {
 	debug("push element", eltName);
-		fStack.top()->push(elt);
+		fStack.top()->push(std::move(elt));
 	}
-	fStack.push(elt);
+	fStack.push(current);
 	return true;
 }
 
@@ -98,7 +192,7 @@ bool xmlreader::newElement (const char* eltName)
 bool xmlreader::endElement (const char* eltName)
 {
 	debug("endElement", eltName);
-	Sxmlelement top = fStack.top();
+	borrowed<xmlelement> top = fStack.top();
 	fStack.pop();
 	return top->getName() == eltName;
 }
@@ -107,11 +201,11 @@ bool xmlreader::endElement (const char* eltName)
 bool xmlreader::newAttribute (const char* name, const char *value)
 {
 	debug("newAttribute", name);
-	Sxmlattribute attr = xmlattribute::create();
+	Sxmlattribute attr = xmlattribute::create(fArena);
 	if (attr) {
 		attr->setName(name);
 		attr->setValue(value);
-		fStack.top()->add(attr);
+		fStack.top()->add(std::move(attr));
 		return true;
 	}
 	return false;
@@ -22,20 +22,46 @@
 namespace MusicXML2 
 {
 
+class mxlarchive;
+class partindex;
+
 //______________________________________________________________________________
 class EXP xmlreader : public reader
 { 
-	std::stack<Sxmlelement>	fStack;
+	std::stack<borrowed<xmlelement> >	fStack;	///< the open elements, owned by the document tree
 	SXMLFile				fFile;
+	arena*					fArena;		// the arena of the current file (if any)
+	bool					fUseArena;
+
+	SXMLFile	newFile ();
+	SXMLFile	readmxl (mxlarchive& archive);
 
 	public:
-				 xmlreader() {}
+				 //! when useArena is true, the documents nodes are allocated from an arena owned by the document
+				 xmlreader(bool useArena=false) : fArena(0), fUseArena(useArena) {}
 		virtual ~xmlreader() {}
 		
 		SXMLFile readbuff(const char* file);
 		SXMLFile read(const char* file);
 		SXMLFile read(FILE* file);
 
+		//! reads a compressed MusicXML file (.mxl)
+		SXMLFile readmxl(const char* file);
+		//! reads a compressed MusicXML file (.mxl) from memory
+		SXMLFile readmxl(const char* data, size_t size);
+		//! reads a document in place: the buffer holds size bytes followed by two null bytes and is modified
+		SXMLFile readinplace(char* buffer, size_t size);
+		/*!
+			\brief reads the header, the part-list and a single part of a score-partwise document
+			The other parts are skipped without being parsed. The whole document is read
+			when it can't be indexed. Note that the input line numbers are relative to
+			the reduced document.
+			\param buffer the document, null terminated
+			\param id the part id
+			\param index the document part index, built on the fly when null
+		*/
+		SXMLFile readpart(const char* buffer, const std::string& id, const partindex* index=0);
+
 		bool	xmlDecl (const char* version, const char *encoding, int standalone);
 		bool	docType (const char* start, bool status, const char *pub, const char *sys);
 
@@ -0,0 +1,224 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <iostream>
+#include "mappedfile.h"
+#include "mxlarchive.h"
+#include "xmlstreamreader.h"
+#include "xml_tree_browser.h"
+#include "elements.h"
+#include "factory.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+extern "C" {
+bool readfile   (const char * file, reader * r);
+bool readstream (FILE * file, reader * r);
+bool readbuffer (const char * buffer, reader * r);
+bool readinplace (char * buffer, size_t size, reader * r);
+}
+
+//_______________________________________________________________________________
+xmlstreamreader::xmlstreamreader(basevisitor* v) : fMaterialize(kEndElement, false), fVisitor(v), fSubtreeDepth(0)
+{
+	materialize (k_note);
+	materialize (k_print);
+	materialize (k_score_part);
+	materialize (k_part_group);
+	materialize (k_backup);
+	materialize (k_forward);
+}
+
+//_______________________________________________________________________________
+void xmlstreamreader::materialize (int type, bool state)
+{
+	if ((type >= 0) && (type < int(fMaterialize.size())))
+		fMaterialize[type] = state;
+}
+
+//_______________________________________________________________________________
+// drops the state of a previous failed read
+void xmlstreamreader::reset ()
+{
+	fStack.clear();
+	fSubtreeDepth = 0;
+}
+
+//_______________________________________________________________________________
+// an element is visited when its first sub element starts or when it ends
+void xmlstreamreader::start (openelement& elt)
+{
+	if (!elt.fVisited) {
+		elt.fVisited = true;
+		elt.fElement->acceptIn (*fVisitor);
+	}
+}
+
+//_______________________________________________________________________________
+// comments and processing instructions are visited as elements with no sub elements
+void xmlstreamreader::leaf (Sxmlelement& elt)
+{
+	// comments outside the xml hierarchy are lost
+	if (fStack.empty()) return;
+	if (fSubtreeDepth)
+		fStack.back().fElement->push (elt);
+	else {
+		start (fStack.back());
+		elt->acceptIn (*fVisitor);
+		elt->acceptOut (*fVisitor);
+	}
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::readbuff(const char* buffer)
+{
+	reset();
+	return readbuffer (buffer, this);
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::read(const char* file)
+{
+	reset();
+	if (!mappedfile::mappable (file))
+		return readfile (file, this);
+	mappedfile content;
+	if (!content.open (file)) {
+		cerr << "can't open file " << file << endl;
+		return false;
+	}
+	unsigned char first = content.size() ? content.data()[0] : 0;
+	if ((first == 0xff) || (first == 0xfe))
+		return readfile (file, this);
+	return readinplace (content.data(), content.size(), this);
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::read(FILE* file)
+{
+	reset();
+	return readstream (file, this);
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::readmxl(mxlarchive& archive)
+{
+	vector<char> buffer;
+	string name = archive.rootfile();
+	if (name.empty() || !archive.extract (name, buffer)) {
+		cerr << "can't find a MusicXML document in the archive" << endl;
+		return false;
+	}
+	reset();
+	return readinplace (&buffer[0], buffer.size() - 2, this);
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::readmxl(const char* file)
+{
+	mxlarchive archive;
+	if (!archive.open (file)) {
+		cerr << "can't open compressed file " << file << endl;
+		return false;
+	}
+	return readmxl (archive);
+}
+
+//_______________________________________________________________________________
+void xmlstreamreader::newComment (const char* comment)
+{
+	Sxmlelement elt = factory::instance().create(kComment, getInputLineNumber());
+	elt->setValue(comment);
+	leaf (elt);
+}
+
+//_______________________________________________________________________________
+void xmlstreamreader::newProcessingInstruction (const char* pi)
+{
+	Sxmlelement elt = factory::instance().create(kProcessingInstruction, getInputLineNumber());
+	elt->setValue(pi);
+	leaf (elt);
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::newElement (const char* eltName)
+{
+	openelement elt;
+	elt.fElement = factory::instance().create(eltName, getInputLineNumber());
+	if (!elt.fElement) return false;
+	elt.fVisited = false;
+
+	if (fSubtreeDepth) {
+		fStack.back().fElement->push (elt.fElement);
+		fSubtreeDepth++;
+	}
+	else {
+		if (fStack.size()) start (fStack.back());
+		if (fMaterialize[elt.fElement->getType()]) fSubtreeDepth = 1;
+	}
+	fStack.push_back (elt);
+	return true;
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::endElement (const char* eltName)
+{
+	if (fStack.empty()) return false;
+	Sxmlelement elt = fStack.back().fElement;
+	if (fSubtreeDepth) {
+		// a materialized subtree is browsed when its root element ends
+		if (--fSubtreeDepth == 0) {
+			xml_tree_browser browser(fVisitor);
+			browser.browse (*elt);
+		}
+	}
+	else {
+		start (fStack.back());
+		elt->acceptOut (*fVisitor);
+	}
+	fStack.pop_back();
+	return elt->getName() == eltName;
+}
+
+//_______________________________________________________________________________
+bool xmlstreamreader::newAttribute (const char* name, const char *value)
+{
+	Sxmlattribute attr = xmlattribute::create();
+	if (attr) {
+		attr->setName(name);
+		attr->setValue(value);
+		fStack.back().fElement->add(attr);
+		return true;
+	}
+	return false;
+}
+
+//_______________________________________________________________________________
+void xmlstreamreader::setValue (const char* value)
+{
+	fStack.back().fElement->setValue(value);
+}
+
+//_______________________________________________________________________________
+void xmlstreamreader::error (const char* s, int lineno)
+{
+	cerr << s  << " on line " << lineno << endl;
+}
+
+}
@@ -0,0 +1,88 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlstreamreader__
+#define __xmlstreamreader__
+
+#include <vector>
+#include <stdio.h>
+#include "exports.h"
+#include "basevisitor.h"
+#include "xml.h"
+#include "reader.h"
+
+namespace MusicXML2
+{
+
+class mxlarchive;
+
+//______________________________________________________________________________
+/*!
+\brief a reader that drives a visitor while a document is parsed
+
+	The document tree is never built: an element is visited as soon as its
+	attributes and its value are known and it is released when it ends, so
+	that the memory is bounded by the document depth. The visitor receives
+	the calls it would receive from an xml_tree_browser, in the same order.
+\n	Some visitors look at the sub elements of an element in visitStart
+	(e.g. notevisitor for the notes or partsummary for the print, backup
+	and forward elements).
+	The element types set using materialize() are read as complete subtrees
+	and browsed when they end: notes, prints, backups, forwards, score parts
+	and part groups are materialized by default.
+*/
+class EXP xmlstreamreader : public reader
+{
+	typedef struct {
+		Sxmlelement	fElement;
+		bool		fVisited;		///< true when visitStart has been called
+	} openelement;
+
+	std::vector<openelement>	fStack;			///< the open elements
+	std::vector<bool>			fMaterialize;	///< the materialized element types
+	basevisitor*				fVisitor;
+	int							fSubtreeDepth;	///< the depth in a materialized subtree, 0 when streaming
+
+	void	reset ();
+	void	start (openelement& elt);
+	void	leaf  (Sxmlelement& elt);
+	bool	readmxl (mxlarchive& archive);
+
+	public:
+				 xmlstreamreader(basevisitor* v);
+		virtual ~xmlstreamreader() {}
+
+		//! elements of this type are read as a subtree before they are visited
+		void	materialize (int type, bool state=true);
+		void	set (basevisitor* v)	{ fVisitor = v; }
+
+		bool	readbuff(const char* buffer);
+		bool	read(const char* file);
+		bool	read(FILE* file);
+		//! reads a compressed MusicXML file (.mxl)
+		bool	readmxl(const char* file);
+
+		bool	xmlDecl (const char* version, const char *encoding, int standalone)	{ return true; }
+		bool	docType (const char* start, bool status, const char *pub, const char *sys)	{ return true; }
+
+		void	newComment (const char* comment);
+		void	newProcessingInstruction (const char* pi);
+		bool	newElement (const char* eltName);
+		bool	newAttribute (const char* eltName, const char *val);
+		void	setValue (const char* value);
+		bool	endElement (const char* eltName);
+		void	error (const char* s, int lineno);
+};
+
+}
+
+#endif
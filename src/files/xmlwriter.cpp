@@ -0,0 +1,217 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <ctype.h>
+#include <string.h>
+
+#ifdef WIN32
+# include <io.h>
+# define writefd _write
+#else
+# include <unistd.h>
+# define writefd ::write
+#endif
+
+#include "xmlwriter.h"
+#include "elements.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+enum { kFlushThreshold = 64 * 1024 };
+
+static const char* kIndentString = "    ";
+
+//______________________________________________________________________________
+// checks if a '&' starts an entity or a character reference
+static bool isreference (const char* p)
+{
+	p++;
+	if (*p == '#') {
+		p++;
+		bool hex = (*p == 'x');
+		if (hex) p++;
+		const char* start = p;
+		while (hex ? isxdigit((unsigned char)*p) : isdigit((unsigned char)*p)) p++;
+		return (p > start) && (*p == ';');
+	}
+	if (!isalpha((unsigned char)*p) && (*p != '_') && (*p != ':')) return false;
+	while (isalnum((unsigned char)*p) || (*p && strchr("_:.-", *p))) p++;
+	return *p == ';';
+}
+
+//______________________________________________________________________________
+xmlwriter::xmlwriter(bool compact)
+	: fStream(0), fFd(-1), fCompact(compact), fError(false), fIndent(0) {}
+
+xmlwriter::xmlwriter(ostream& out, bool compact)
+	: fStream(&out), fFd(-1), fCompact(compact), fError(false), fIndent(0)
+{
+	fBuffer.reserve (kFlushThreshold + 1024);
+}
+
+xmlwriter::xmlwriter(int fd, bool compact)
+	: fStream(0), fFd(fd), fCompact(compact), fError(false), fIndent(0)
+{
+	fBuffer.reserve (kFlushThreshold + 1024);
+}
+
+//______________________________________________________________________________
+void xmlwriter::flush (size_t threshold)
+{
+	if (fBuffer.size() < threshold) return;
+	if (fStream) {
+		fStream->write (fBuffer.data(), fBuffer.size());
+		if (!fStream->good()) fError = true;
+	}
+	else if (fFd >= 0) {
+		const char* p = fBuffer.data();
+		size_t size = fBuffer.size();
+		while (size) {
+			long n = long(writefd (fFd, p, (unsigned int)size));
+			if (n <= 0) { fError = true; break; }
+			p += n;
+			size -= n;
+		}
+	}
+	else return;		// the output is kept in the buffer
+	fBuffer.clear();
+}
+
+bool xmlwriter::flush ()
+{
+	flush (1);
+	if (fStream) fStream->flush();
+	return !fError;
+}
+
+//______________________________________________________________________________
+void xmlwriter::newline ()
+{
+	if (fCompact) return;
+	fBuffer += '\n';
+	for (int i = 0; i < fIndent; i++) fBuffer += kIndentString;
+}
+
+//______________________________________________________________________________
+void xmlwriter::text (const string& str, bool attribute)
+{
+	const char* specials = attribute ? "&<\"" : "&<";
+	size_t start = 0;
+	size_t pos = str.find_first_of (specials);
+	while (pos != string::npos) {
+		fBuffer.append (str, start, pos - start);
+		switch (str[pos]) {
+			case '&':	fBuffer += isreference(str.c_str() + pos) ? "&" : "&amp;"; break;
+			case '<':	fBuffer += "&lt;"; break;
+			case '"':	fBuffer += "&quot;"; break;
+		}
+		start = pos + 1;
+		pos = str.find_first_of (specials, start);
+	}
+	fBuffer.append (str, start, string::npos);
+}
+
+//______________________________________________________________________________
+void xmlwriter::element (const xmlelement* elt)
+{
+	newline();
+	int type = elt->getType();
+	if (type == kComment) {
+		fBuffer += "<!--";
+		fBuffer += elt->getValue();
+		fBuffer += "-->";
+		return;
+	}
+	if (type == kProcessingInstruction) {
+		fBuffer += "<?";
+		fBuffer += elt->getValue();
+		fBuffer += "?>";
+		return;
+	}
+
+	const string& name = elt->getName();
+	fBuffer += '<';
+	fBuffer += name;
+	const vector<Sxmlattribute>& attributes = elt->attributes();
+	for (vector<Sxmlattribute>::const_iterator i = attributes.begin(); i != attributes.end(); i++) {
+		fBuffer += ' ';
+		fBuffer += (*i)->getName();
+		fBuffer += "=\"";
+		text ((*i)->getValue(), true);
+		fBuffer += '"';
+	}
+	if (elt->empty()) {
+		fBuffer += "/>";
+		return;
+	}
+	fBuffer += '>';
+	text (elt->getValue(), false);
+	const ctree<xmlelement>::branchs& elements = elt->elements();
+	if (elements.size()) {
+		fIndent++;
+		for (ctree<xmlelement>::branchs::const_iterator i = elements.begin(); i != elements.end(); i++)
+			element (*i);
+		fIndent--;
+		newline();
+	}
+	fBuffer += "</";
+	fBuffer += name;
+	fBuffer += '>';
+	flush (kFlushThreshold);
+}
+
+//______________________________________________________________________________
+void xmlwriter::write (const Sxmlelement& elt)
+{
+	if (elt) element (elt);
+	flush (kFlushThreshold);
+}
+
+//______________________________________________________________________________
+void xmlwriter::write (TXMLFile& file)
+{
+	TXMLDecl* decl = file.getXMLDecl();
+	if (decl) {
+		fBuffer += "<?xml version=\"";
+		fBuffer += decl->getVersion();
+		fBuffer += '"';
+		if (!decl->getEncoding().empty()) {
+			fBuffer += " encoding=\"";
+			fBuffer += decl->getEncoding();
+			fBuffer += '"';
+		}
+		if (decl->getStandalone() != TXMLDecl::kundefined)
+			fBuffer += decl->getStandalone() ? " standalone=\"yes\"" : " standalone=\"no\"";
+		fBuffer += "?>";
+	}
+	TDocType* doctype = file.getDocType();
+	if (doctype) {
+		if (!fCompact) fBuffer += '\n';
+		fBuffer += "<!DOCTYPE ";
+		fBuffer += doctype->getStartElement();
+		fBuffer += doctype->getPublic() ? " PUBLIC \"" : " SYSTEM \"";
+		fBuffer += doctype->getPubLitteral();
+		fBuffer += fCompact ? "\" \"" : "\"\n\t\t\t\"";
+		fBuffer += doctype->getSysLitteral();
+		fBuffer += "\">";
+	}
+	write (file.elements());
+}
+
+}
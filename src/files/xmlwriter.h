@@ -0,0 +1,74 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __xmlwriter__
+#define __xmlwriter__
+
+#include <ostream>
+#include <string>
+#include "exports.h"
+#include "xml.h"
+#include "xmlfile.h"
+
+namespace MusicXML2
+{
+
+//______________________________________________________________________________
+/*!
+\brief writes a document or an element tree as xml text
+
+	The output is collected in a byte buffer that is flushed to a file
+	descriptor or to a stream when it grows beyond a threshold (or kept
+	when there is no output). The indented output is the same as the
+	xmlvisitor output; the compact output has no whitespace between the
+	elements.
+\n	Values and attributes values are escaped: a '&' that doesn't start
+	an entity or a character reference and a '<' are replaced with their
+	entity reference, as well as the '"' in the attributes values. The
+	values read from a file keep their entity references.
+*/
+class EXP xmlwriter
+{
+	std::string		fBuffer;
+	std::ostream*	fStream;	///< the output stream (or null)
+	int				fFd;		///< the output file descriptor (or -1)
+	bool			fCompact;
+	bool			fError;
+	int				fIndent;
+
+	void	flush (size_t threshold);
+	void	newline ();
+	void	text (const std::string& str, bool attribute);
+	void	element (const xmlelement* elt);
+
+	public:
+		//! the output is kept in a buffer, see str()
+				 xmlwriter(bool compact=false);
+		//! the output is written to a stream
+				 xmlwriter(std::ostream& out, bool compact=false);
+		//! the output is written to a file descriptor
+				 xmlwriter(int fd, bool compact=false);
+		virtual ~xmlwriter()		{ flush(); }
+
+		void	write (const Sxmlelement& elt);
+		void	write (TXMLFile& file);
+		//! writes the pending output, returns false when an output error occured
+		bool	flush ();
+
+		//! the buffered output
+		const std::string&	str () const	{ return fBuffer; }
+		void				clear ()		{ fBuffer.clear(); fIndent = 0; fError = false; }
+};
+
+}
+
+#endif
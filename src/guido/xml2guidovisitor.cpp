@@ -15,8 +15,10 @@
 #endif
 
 #include <iostream>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <vector>
 
 #include "partsummary.h"
 #include "rational.h"
@@ -33,7 +35,7 @@ namespace MusicXML2
     //______________________________________________________________________________
     xml2guidovisitor::xml2guidovisitor(bool generateComments, bool generateStem, bool generateBar, int partNum) :
     fGenerateComments(generateComments), fGenerateStem(generateStem),
-    fGenerateBars(generateBar), fGeneratePositions(true),
+    fGenerateBars(generateBar), fGeneratePositions(true), fSinglePass(false),
     fCurrentStaffIndex(0), previousStaffHasLyrics(false), fCurrentAccoladeIndex(0), fPartNum(partNum), defaultStaffDistance(0), defaultGuidoStaffDistance(1)
     {
         timePositions.clear();
@@ -190,6 +192,95 @@ namespace MusicXML2
     //void xml2guidovisitor::visitStart ( S_score_part& elt )			{ fCurrentPartID = elt->getAttributeValue("id"); }
     //void xml2guidovisitor::visitStart ( S_part_name& elt )			{ fPartHeaders[fCurrentPartID].fPartName = elt; }
     
+    //______________________________________________________________________________
+    // opens the guido sequence of a voice and writes the staff and part headers
+    Sguidoelement xml2guidovisitor::startVoice ( S_part& elt, const partsummary& ps, int targetStaff )
+    {
+        Sguidoelement seq = guidoseq::create();
+        push (seq);
+        
+        Sguidoelement tag = guidotag::create("staff");
+        tag->add (guidoparam::create(fCurrentStaffIndex, false));
+        add (tag);
+                    
+        //// Add staffFormat if needed
+        // Case1: If previous staff has Lyrics, then move current staff lower to create space: \staffFormat<dy=-5>
+        int stafflines = elt->getIntValue(k_staff_lines, 0);
+        
+        if ((previousStaffHasLyrics)||stafflines||defaultGuidoStaffDistance||fStaffDistances.size())
+        {
+            Sguidoelement tag2 = guidotag::create("staffFormat");
+            if (previousStaffHasLyrics)
+            {
+                tag2->add (guidoparam::create("dy=-5", false));
+            }else if (fStaffDistances.size()> (targetStaff-1)) {
+                
+                if (fStaffDistances[targetStaff-1] > 0) {
+                    float xmlDistance = fStaffDistances[targetStaff-1] - 50.0;
+                    float HalfSpaceDistance = -1.0 * (xmlDistance / 10) * 2 ; // -1.0 for Guido scale // (pos/10)*2
+                
+                    stringstream s;
+                    s << "dy="<< HalfSpaceDistance;
+                    tag2->add (guidoparam::create(s.str().c_str(), false));
+                }
+            }else if (defaultGuidoStaffDistance) {
+                stringstream s;
+                s << "dy="<< defaultGuidoStaffDistance;
+                tag2->add (guidoparam::create(s.str().c_str(), false));
+            }
+            
+            if (stafflines>0)
+            {
+                stringstream staffstyle;
+                staffstyle << "style=\"" << stafflines<<"-line\"";
+                tag2->add (guidoparam::create(staffstyle.str(),false));
+            }
+            add (tag2);
+        }
+        ////
+        
+        flushHeader (fHeader);
+        flushPartHeader (fPartHeaders[elt->getAttributeValue("id")]);
+        flushPartGroup  (elt->getAttributeValue("id"));
+        
+        //// Add Accolade if countStaves on this Part is >1, and we are entering span
+        if ((ps.countStaves()>1)&&(fCurrentStaffIndex>fCurrentAccoladeIndex))
+        {
+            int rangeEnd = fCurrentStaffIndex + ps.countStaves() - 1;
+
+				stringstream accol;
+				accol << "id=" << fCurrentAccoladeIndex << ", range=\"" << fCurrentStaffIndex << "-" << rangeEnd << "\"";
+				stringstream barformat;
+				barformat << "style= \"system\", range=\"" << fCurrentStaffIndex << "-" << rangeEnd << "\"";
+				
+            Sguidoelement tag3 = guidotag::create("accol");
+            tag3->add (guidoparam::create(accol.str(), false));
+            add (tag3);
+            
+            // add new barFormat tag
+            Sguidoelement tag4 = guidotag::create("barFormat");
+            tag4->add (guidoparam::create(barformat.str(), false));
+            add (tag4);
+				
+            fCurrentAccoladeIndex = rangeEnd;
+        }else {
+            
+            // if we have multiple staves, and this staff has NO barFormat, then we should add one like \barFormat<style="system", range="1">
+            // Otherwise there'll be no bar lines!!!
+            if (checkLonelyBarFormat(fCurrentStaffIndex))
+            {
+					stringstream barformat;
+					barformat << "style= \"system\", range=\"" << fCurrentStaffIndex << "\"";
+                Sguidoelement tag4 = guidotag::create("barFormat");
+                tag4->add (guidoparam::create(barformat.str(), false));
+                add (tag4);
+            }
+        }
+        
+        ////
+        return seq;
+    }
+    
     //______________________________________________________________________________
     void xml2guidovisitor::visitStart ( S_part& elt )
     {
@@ -203,21 +294,23 @@ namespace MusicXML2
             }
         }
         
-        partsummary ps;
-        xml_tree_browser browser(&ps);
-        browser.browse(*elt);
+        // the summary is computed once for the part and reused by the next conversions
+        const partsummary& ps = partsummary::get (elt);
+        fStaffDistances = ps.fStaffDistances;
+        
+        staffClefMap.clear();
+        //timePositions.clear();
         
-        smartlist<int>::ptr voices = ps.getVoices ();
+        if (fSinglePass && convertVoicesTogether (elt, ps)) return;
+        
+        const vector<int>& voices = ps.voices ();
         int targetStaff = 0xffff;	// initialized to a value we'll unlikely encounter
         bool notesOnly = false;
         rational currentTimeSign (0,1);
         
-        staffClefMap.clear();
-        //timePositions.clear();
-        
         // browse the parts voice by voice: allows to describe voices that spans over several staves
-        for (unsigned int i = 0; i < voices->size(); i++) {
-            int targetVoice = (*voices)[i];
+        for (unsigned int i = 0; i < voices.size(); i++) {
+            int targetVoice = voices[i];
             int mainstaff = ps.getMainStaff(targetVoice);
             if (targetStaff == mainstaff) {
                 notesOnly = true;
@@ -230,88 +323,7 @@ namespace MusicXML2
                 timePositions.clear();
             }
             
-            Sguidoelement seq = guidoseq::create();
-            push (seq);
-            
-            Sguidoelement tag = guidotag::create("staff");
-            tag->add (guidoparam::create(fCurrentStaffIndex, false));
-            add (tag);
-                        
-            //// Add staffFormat if needed
-            // Case1: If previous staff has Lyrics, then move current staff lower to create space: \staffFormat<dy=-5>
-            int stafflines = elt->getIntValue(k_staff_lines, 0);
-            
-            if ((previousStaffHasLyrics)||stafflines||defaultGuidoStaffDistance||ps.fStaffDistances.size())
-            {
-                Sguidoelement tag2 = guidotag::create("staffFormat");
-                if (previousStaffHasLyrics)
-                {
-                    tag2->add (guidoparam::create("dy=-5", false));
-                }else if (ps.fStaffDistances.size()> (targetStaff-1)) {
-                    
-                    if (ps.fStaffDistances[targetStaff-1] > 0) {
-                        float xmlDistance = ps.fStaffDistances[targetStaff-1] - 50.0;
-                        float HalfSpaceDistance = -1.0 * (xmlDistance / 10) * 2 ; // -1.0 for Guido scale // (pos/10)*2
-                    
-                        stringstream s;
-                        s << "dy="<< HalfSpaceDistance;
-                        tag2->add (guidoparam::create(s.str().c_str(), false));
-                    }
-                }else if (defaultGuidoStaffDistance) {
-                    stringstream s;
-                    s << "dy="<< defaultGuidoStaffDistance;
-                    tag2->add (guidoparam::create(s.str().c_str(), false));
-                }
-                
-                if (stafflines>0)
-                {
-                    stringstream staffstyle;
-                    staffstyle << "style=\"" << stafflines<<"-line\"";
-                    tag2->add (guidoparam::create(staffstyle.str(),false));
-                }
-                add (tag2);
-            }
-            ////
-            
-            flushHeader (fHeader);
-            flushPartHeader (fPartHeaders[elt->getAttributeValue("id")]);
-            flushPartGroup  (elt->getAttributeValue("id"));
-            
-            //// Add Accolade if countStaves on this Part is >1, and we are entering span
-            if ((ps.countStaves()>1)&&(fCurrentStaffIndex>fCurrentAccoladeIndex))
-            {
-                int rangeEnd = fCurrentStaffIndex + ps.countStaves() - 1;
-
-				stringstream accol;
-				accol << "id=" << fCurrentAccoladeIndex << ", range=\"" << fCurrentStaffIndex << "-" << rangeEnd << "\"";
-				stringstream barformat;
-				barformat << "style= \"system\", range=\"" << fCurrentStaffIndex << "-" << rangeEnd << "\"";
-				
-                Sguidoelement tag3 = guidotag::create("accol");
-                tag3->add (guidoparam::create(accol.str(), false));
-                add (tag3);
-                
-                // add new barFormat tag
-                Sguidoelement tag4 = guidotag::create("barFormat");
-                tag4->add (guidoparam::create(barformat.str(), false));
-                add (tag4);
-				
-                fCurrentAccoladeIndex = rangeEnd;
-            }else {
-                
-                // if we have multiple staves, and this staff has NO barFormat, then we should add one like \barFormat<style="system", range="1">
-                // Otherwise there'll be no bar lines!!!
-                if (checkLonelyBarFormat(fCurrentStaffIndex))
-                {
-					stringstream barformat;
-					barformat << "style= \"system\", range=\"" << fCurrentStaffIndex << "\"";
-                    Sguidoelement tag4 = guidotag::create("barFormat");
-                    tag4->add (guidoparam::create(barformat.str(), false));
-                    add (tag4);
-                }
-            }
-            
-            ////
+            Sguidoelement seq = startVoice (elt, ps, targetStaff);
             
             //// Browse XML and convert
             xmlpart2guido pv(fGenerateComments, fGenerateStem, fGenerateBars);
@@ -329,6 +341,86 @@ namespace MusicXML2
         }
     }
     
+    //______________________________________________________________________________
+    // converts all the voices of a part with shared part walks (see setSinglePass)
+    // the voices of a same staff depend on the complete output of the previous ones
+    // (x positions and clefs): the first voice of every staff is converted in the first
+    // walk, the second ones in the next walk, etc.
+    // returns false and leaves the state unchanged when the voices turn out to depend
+    // on each other in a way that can't be reproduced (clefs looked up on another staff)
+    bool xml2guidovisitor::convertVoicesTogether ( S_part& elt, const partsummary& ps )
+    {
+        const vector<int>& voices = ps.voices ();
+        size_t count = voices.size();
+        
+        // computes the staves of the voices like the voice by voice conversion
+        vector<int> staff(count), staffIndex(count), rank(count), previous(count);
+        int targetStaff = 0xffff, index = fCurrentStaffIndex, rounds = 0;
+        for (size_t i = 0; i < count; i++) {
+            int mainstaff = ps.getMainStaff(voices[i]);
+            if ((i > 0) && (targetStaff == mainstaff)) {
+                rank[i] = rank[i-1] + 1;
+                previous[i] = int(i) - 1;
+            }
+            else {
+                targetStaff = mainstaff;
+                index++;
+                rank[i] = 0;
+                previous[i] = -1;
+            }
+            staff[i] = targetStaff;
+            staffIndex[i] = index;
+            if (rank[i] >= rounds) rounds = rank[i] + 1;
+        }
+        
+        vector<unique_ptr<xmlpart2guido> > pv(count);
+        vector<Sguidoelement> body(count);
+        for (size_t i = 0; i < count; i++) {
+            pv[i].reset (new xmlpart2guido(fGenerateComments, fGenerateStem, fGenerateBars));
+            pv[i]->generatePositions (fGeneratePositions);
+            body[i] = guidoseq::create();
+            pv[i]->initialize(body[i], staff[i], staffIndex[i], voices[i], rank[i] > 0, rational(0,1));
+        }
+        
+        for (int round = 0; round < rounds; round++) {
+            multi_tree_browser<xmlelement> browser;
+            for (size_t i = 0; i < count; i++) {
+                if (rank[i] != round) continue;
+                if (round) {
+                    // the state left by the previous voices, as in a voice by voice conversion
+                    pv[i]->timePositions = pv[previous[i]]->timePositions;
+                    for (size_t j = 0; j < i; j++)
+                        if (rank[j] == 0) pv[i]->staffClefMap.insert (pv[j]->staffClefMap.begin(), pv[j]->staffClefMap.end());
+                }
+                browser.add (pv[i].get());
+            }
+            browser.browse(*elt);
+            if (round == 0) {
+                for (size_t i = 0; i < count; i++)
+                    if (pv[i]->otherStaffClefs()) return false;
+            }
+        }
+        
+        // collects the voices in order
+        targetStaff = 0xffff;
+        for (size_t i = 0; i < count; i++) {
+            if (rank[i] == 0) {
+                targetStaff = staff[i];
+                fCurrentStaffIndex++;
+                staffClefMap.insert (pv[i]->staffClefMap.begin(), pv[i]->staffClefMap.end());
+            }
+            Sguidoelement seq = startVoice (elt, ps, targetStaff);
+            for (size_t e = 0; e < body[i]->elements().size(); e++)
+                seq->add (body[i]->elements()[e]);
+            for (size_t p = 0; p < body[i]->parameters().size(); p++)
+                seq->add (body[i]->parameters()[p]);
+            pop();
+            previousStaffHasLyrics = pv[i]->hasLyrics();
+            timePositions = pv[i]->timePositions;
+        }
+        return true;
+    }
+    
     //______________________________________________________________________________
     void xml2guidovisitor::addPosition	( Sxmlelement elt, Sguidoelement& tag, int yoffset)
     {
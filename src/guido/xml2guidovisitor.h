@@ -27,6 +27,7 @@
 
 
 #include "partlistvisitor.h"
+#include "partsummary.h"
 
 
 namespace MusicXML2 
@@ -65,6 +66,7 @@ class EXP xml2guidovisitor :
 	// the guido elements stack
 	std::stack<Sguidoelement>	fStack;
 	bool	fGenerateComments, fGenerateStem, fGenerateBars, fGeneratePositions;
+	bool	fSinglePass;		// converts the voices of a part with shared part walks
 	
 	scoreHeader		fHeader;		// musicxml header elements (should be flushed at the beginning of the first voice)
 	//partHeaderMap	fPartHeaders;	// musicxml score-part elements (should be flushed at the beginning of each part)
@@ -80,6 +82,9 @@ class EXP xml2guidovisitor :
 	void flushPartHeader ( partHeader& header );
     void flushPartGroup (std::string partID);
 
+	Sguidoelement	startVoice (S_part& elt, const partsummary& ps, int targetStaff);
+	bool			convertVoicesTogether (S_part& elt, const partsummary& ps);
+
 	protected:
 
 		virtual void visitStart( S_score_partwise& elt);
@@ -99,6 +104,7 @@ class EXP xml2guidovisitor :
     
     int defaultStaffDistance;   // xml staff-distance value in defaults
     int defaultGuidoStaffDistance;  // the above converted to Guido value
+    std::map<int, int> fStaffDistances;  // the staff distances of the current part (from its summary)
     
     /// multimap containing <staff-num, measureNum, position, clef type>
     //std::multimap<int, std::pair< rational, string > > staffClefMap;
@@ -117,6 +123,9 @@ class EXP xml2guidovisitor :
 		// this is to control exact positionning of elements when information is present
 		// ie converts relative-x/-y into dx/dy attributes
 		void generatePositions (bool state)		{ fGeneratePositions = state; }
+		// converts the voices of a part together, walking the part once per voice rank on a staff
+		// rather than once per voice. The output is unchanged.
+		void singlePass (bool state)			{ fSinglePass = state; }
 
     static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, int yoffset);
 	static void addPosition	 ( Sxmlelement elt, Sguidoelement& tag, int yoffset, int xoffset);
@@ -33,7 +33,7 @@ namespace MusicXML2
     xmlpart2guido::xmlpart2guido(bool generateComments, bool generateStem, bool generateBar) :
     fGenerateComments(generateComments), //fGenerateStem(generateStem),
     fGenerateBars(generateBar),
-    fNotesOnly(false), fCurrentStaffIndex(0), fCurrentStaff(0),
+    fNotesOnly(false), fCurrentStaffIndex(0), fTargetStaffIndex(0), fOtherStaffClefs(false), fCurrentStaff(0),
     fTargetStaff(0), fTargetVoice(0)
     {
         fGeneratePositions = true;
@@ -78,7 +78,8 @@ namespace MusicXML2
         fTargetVoice = voice;					// the target voice
         fNotesOnly = notesonly;					// prevent multiple output for keys, clefs etc...
         fCurrentTimeSign = defaultTimeSign;		// a default time signature
-        fCurrentStaffIndex = guidostaff;		// the current guido staff index
+        fCurrentStaffIndex = fTargetStaffIndex = guidostaff;		// the current guido staff index
+        fOtherStaffClefs = false;
         fHasLyrics = false;
         fLyricsManualSpacing = false;
         fDynamics= (void*)0;
@@ -133,13 +134,11 @@ namespace MusicXML2
             fInCue = false;
             
             // add EMPTY if durationInCue>0 and fCurrentMeasurePosition is not equal to fCurrentMeasureLength
-            durationInCue.rationalise();
             if (durationInCue.getNumerator() > 0) {
                 guidonoteduration dur (durationInCue.getNumerator(), durationInCue.getDenominator());
                 Sguidoelement note = guidonote::create(fTargetVoice, "empty", 0, dur, "");
                 add (note);
                 fCurrentVoicePosition += durationInCue;
-                fCurrentVoicePosition.rationalise();
             }
             
             durationInCue = 0;
@@ -177,12 +176,10 @@ namespace MusicXML2
         rational r(duration, fCurrentDivision*4);
         r.rationalise();
         fCurrentMeasurePosition += r;
-        fCurrentMeasurePosition.rationalise();
         if (fCurrentMeasurePosition > fCurrentMeasureLength)
             fCurrentMeasureLength = fCurrentMeasurePosition;
         if (moveVoiceToo) {
             fCurrentVoicePosition += r;
-            fCurrentVoicePosition.rationalise();
         }
     }
     
@@ -193,13 +190,11 @@ namespace MusicXML2
     void xmlpart2guido::checkVoiceTime ( const rational& currTime, const rational& voiceTime)
     {
         rational diff = currTime - voiceTime;
-        diff.rationalise();
         if (diff.getNumerator() > 0) {
             guidonoteduration dur (diff.getNumerator(), diff.getDenominator());
             Sguidoelement note = guidonote::create(fTargetVoice, "empty", 0, dur, "");
             add (note);
             fCurrentVoicePosition += diff;
-            fCurrentVoicePosition.rationalise();
         }
         else if (diff.getNumerator() < 0)
         {
@@ -212,7 +207,7 @@ namespace MusicXML2
     void xmlpart2guido::visitStart ( S_backup& elt )
     {
         stackClean();	// closes pending chords, cue and grace
-        int duration = elt->getIntValue(k_duration, 0);
+        int duration = elt->getChildIntValue(k_duration, 0);
         if (duration) {
             // backup is supposed to be used only for moving between voices
             // thus we don't move the voice time (which is supposed to be 0)
@@ -223,9 +218,9 @@ namespace MusicXML2
     //______________________________________________________________________________
     void xmlpart2guido::visitStart ( S_forward& elt )
     {
-        bool scanElement = (elt->getIntValue(k_voice, 0) == fTargetVoice)
-        && (elt->getIntValue(k_staff, 0) == fTargetStaff);
-        int duration = elt->getIntValue(k_duration, 0);
+        bool scanElement = (elt->getChildIntValue(k_voice, 0) == fTargetVoice)
+        && (elt->getChildIntValue(k_staff, 0) == fTargetStaff);
+        int duration = elt->getChildIntValue(k_duration, 0);
         moveMeasureTime(duration, scanElement);
         if (!scanElement) return;
         
@@ -323,7 +318,7 @@ namespace MusicXML2
     //______________________________________________________________________________
     void xmlpart2guido::visitStart ( S_direction& elt )
     {
-        if (fNotesOnly || (elt->getIntValue(k_staff, 0) != fTargetStaff)) {
+        if (fNotesOnly || (elt->getChildIntValue(k_staff, 0) != fTargetStaff)) {
             fSkipDirection = true;
         }
         else {
@@ -1393,11 +1388,11 @@ namespace MusicXML2
                 }
                 while (nextnote != fCurrentMeasure->end()) {
                     // looking for the next note on the target voice
-                    if ((nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice)) {
+                    if ((nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice)) {
                         
-                        if ( abs( nextnote->getIntValue(k_duration, 0) - topNoteDur) > (fCurrentDivision/10) ) {
+                        if ( abs( nextnote->getChildIntValue(k_duration, 0) - topNoteDur) > (fCurrentDivision/10) ) {
                             useDispNoteAttribute =  false;
-                            cerr <<"TUPLET EVADED DISPNOTE Measure:"<<fMeasNum <<"Division:"<< fCurrentDivision <<"--> topBoteDur:"<<topNoteDur<<" this note dur="<<nextnote->getIntValue(k_duration, 0)<<endl;
+                            cerr <<"TUPLET EVADED DISPNOTE Measure:"<<fMeasNum <<"Division:"<< fCurrentDivision <<"--> topBoteDur:"<<topNoteDur<<" this note dur="<<nextnote->getChildIntValue(k_duration, 0)<<endl;
                             break;
                         }
                         
@@ -1882,7 +1877,7 @@ namespace MusicXML2
         if (nextnote != fCurrentMeasure->end()) nextnote++;	// advance one step
         while (nextnote != fCurrentMeasure->end()) {
             // looking for the next note on the target voice
-            if ((nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice)) {
+            if ((nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice)) {
                 ctree<xmlelement>::iterator iter;			// and when there is one
                 iter = nextnote->find(k_chord);
                 if (iter != nextnote->end())
@@ -1916,13 +1911,11 @@ namespace MusicXML2
             fInCue = false;
             pop();
             
-            durationInCue.rationalise();
             if (durationInCue.getNumerator() > 0) {
                 guidonoteduration dur (durationInCue.getNumerator(), durationInCue.getDenominator());
                 Sguidoelement note = guidonote::create(fTargetVoice, "empty", 0, dur, "");
                 add (note);
                 fCurrentVoicePosition += durationInCue;
-                fCurrentVoicePosition.rationalise();
             }
             
             durationInCue = 0;
@@ -1953,7 +1946,7 @@ namespace MusicXML2
             ctree<xmlelement>::iterator nextnote = find(fCurrentMeasure->begin(), fCurrentMeasure->end(), nv.getSnote());
             nextnote++;	// advance one step
             while (nextnote != fCurrentMeasure->end()) {
-                if ((nextnote->getType() == k_note) && (nextnote->getIntValue(k_voice,0) == fTargetVoice)){
+                if ((nextnote->getType() == k_note) && (nextnote->getChildIntValue(k_voice,0) == fTargetVoice)){
                     ctree<xmlelement>::iterator iter = nextnote->find(k_grace);
                     if (iter != nextnote->end())
                     {
@@ -2021,7 +2014,6 @@ namespace MusicXML2
                 r.rationalise();
                 rational tm = nv.getTimeModification();
                 r *= tm;
-                r.rationalise();
                 dur.set (r.getNumerator(), r.getDenominator(), nv.getDots());
             }
         }
@@ -2032,7 +2024,6 @@ namespace MusicXML2
             r.rationalise();
             rational tm = nv.getTimeModification();
             r *= tm;
-            r.rationalise();
             dur.set (r.getNumerator(), r.getDenominator(), nv.getDots());
         }
         return dur;
@@ -2170,6 +2161,7 @@ namespace MusicXML2
     std::string xmlpart2guido::getClef(int staffIndex, rational pos, int measureNum) {
         //     std::multimap<int,  std::pair< int, std::pair< rational, string > > > staffClefMap;
         std::string thisClef = "g";
+        if (staffIndex != fTargetStaffIndex) fOtherStaffClefs = true;
         if (staffClefMap.size()>0) {
             auto staffRange = staffClefMap.equal_range(staffIndex);
 
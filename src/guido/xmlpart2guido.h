@@ -100,6 +100,8 @@ class EXP xmlpart2guido :
 	bool	fNotesOnly;				// a flag to generate notes only (used for several voices on the same staff)
 	bool	fSkipDirection;			// a flag to skip direction elements (for notes only mode or due to different staff)
 	int		fCurrentStaffIndex;		// the index of the current guido staff
+	int		fTargetStaffIndex;		// the index of the guido staff of the target staff
+	bool	fOtherStaffClefs;		// a flag set when the clefs of another guido staff have been looked up
 	int		fCurrentStaff;			// the staff we're currently generating events for (0 by default)
 	int		fTargetStaff;			// the musicxml target staff (0 by default)
 	int		fTargetVoice;			// the musicxml target voice (0 by default)
@@ -225,6 +227,8 @@ class EXP xmlpart2guido :
 		const rational& getTimeSign () const		{ return fCurrentTimeSign; }
         bool fHasLyrics;
         bool hasLyrics() const {return fHasLyrics;}
+		//! true when the clefs of another staff have been looked up, ie when the output depends on the other voices
+		bool	otherStaffClefs () const			{ return fOtherStaffClefs; }
 //    std::multimap<int, std::pair< rational, string > > staffClefMap;
     std::multimap<int,  std::pair< int, std::pair< rational, string > > > staffClefMap;
 
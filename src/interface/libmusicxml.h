@@ -25,6 +25,12 @@
 
 namespace MusicXML2 
 {
+/*!
+	\brief the conversions error codes
+	
+	\c kUnsupported is returned for the score-timewise documents and for the
+	documents whose durations can't be computed without overflowing.
+*/
 enum xmlErr { kNoErr, kInvalidFile, kUnsupported };
 
 #ifdef __cplusplus
@@ -122,6 +128,62 @@ EXP xmlErr      musicxmlstring2guido(const char *buff, bool generateBars, std::o
  */
 EXP xmlErr      musicxmlstring2guidoOnPart(const char * buffer, bool generateBars, int partFilter, std::ostream& out);
 
+/*!
+  \brief Converts a compressed MusicXML file (.mxl) to the Guido format.
+  \param file a file name 
+  \param generateBars a boolean to force barlines generation
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlmxlfile2guido  (const char *file, bool generateBars, std::ostream& out);
+
+/*!
+  \brief Converts compressed MusicXML data (the content of a .mxl file) to the Guido format.
+  \param data the compressed data
+  \param size the data size
+  \param generateBars a boolean to force barlines generation
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlmxldata2guido  (const char *data, size_t size, bool generateBars, std::ostream& out);
+
+/*! @} */
+
+/*!
+\addtogroup Converting MusicXML to Standard MIDI Files
+
+The library includes a high level API to convert from the MusicXML format to
+Standard MIDI Files (type 1). The repeats, da capo, dal segno and coda signs are
+unrolled. The output stream should be opened in binary mode.
+@{
+*/
+
+/*!
+  \brief Converts a MusicXML representation to a Standard MIDI File.
+  \param file a file name 
+  \param tpq the MIDI file time resolution in ticks per quarter note
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlfile2midi  (const char *file, long tpq, std::ostream& out);
+
+/*!
+  \brief Converts a MusicXML representation to a Standard MIDI File.
+  \param fd a file descriptor 
+  \param tpq the MIDI file time resolution in ticks per quarter note
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlfd2midi  (FILE* fd, long tpq, std::ostream& out);
+
+/*!
+  \brief Converts a MusicXML representation to a Standard MIDI File.
+  \param buff a string containing MusicXML code
+  \param tpq the MIDI file time resolution in ticks per quarter note
+  \param out the output stream
+  \return an error code (\c kNoErr when success)
+*/
+EXP xmlErr      musicxmlstring2midi(const char *buff, long tpq, std::ostream& out);
 /*! @} */
 
 
@@ -14,8 +14,13 @@
 # pragma warning (disable : 4786)
 #endif
 
+#include <sstream>
+#include <stdexcept>
+
 #include "messagesHandling.h"
 
+#include "xml2lyOptionsHandling.h"
+
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
   #include "traceOptions.h"
@@ -74,12 +79,28 @@ void generateLilypondCodeFromLpsrScore (
       lpScore);
   
   // build the LPSR score    
-  translator.generateLilypondCodeFromLpsrScore ();
+  try {
+    translator.generateLilypondCodeFromLpsrScore ();
+  }
+  catch (std::overflow_error& e) {
+    // the positions and durations are rationals, see rational.h
+    stringstream s;
+
+    s <<
+      "the durations in this score can't be computed: " <<
+      e.what ();
+      
+    lpsrMusicXMLError (
+      gXml2lyOptions->fInputSourceName,
+      1, // inputLineNumber,
+      __FILE__, __LINE__,
+      s.str ());
+  }
 
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 4",
     "translate LPSR to LilyPond",
     timingItem::kMandatory,
@@ -15,6 +15,8 @@
 #endif
 
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 
 #include "xml.h"
 #include "xmlfile.h"
@@ -22,6 +24,10 @@
 
 #include "versions.h"
 
+#include "messagesHandling.h"
+
+#include "xml2lyOptionsHandling.h"
+
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
   #include "traceOptions.h"
@@ -75,12 +81,28 @@ S_lpsrScore buildLpsrScoreFromMsrScore (
       mScore);
       
   // build the LPSR score
-  translator.buildLpsrScoreFromMsrScore ();
+  try {
+    translator.buildLpsrScoreFromMsrScore ();
+  }
+  catch (std::overflow_error& e) {
+    // the positions and durations are rationals, see rational.h
+    stringstream s;
+
+    s <<
+      "the durations in this score can't be computed: " <<
+      e.what ();
+      
+    lpsrMusicXMLError (
+      gXml2lyOptions->fInputSourceName,
+      1, // inputLineNumber,
+      __FILE__, __LINE__,
+      s.str ());
+  }
 
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 3",
     "translate MSR to LPSR",
     timingItem::kMandatory,
@@ -130,7 +152,7 @@ void displayLpsrScore (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display the LPSR",
     timingItem::kOptional,
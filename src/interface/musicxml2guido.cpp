@@ -15,6 +15,8 @@
 #endif
 
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 #include "libmusicxml.h"
 #include "xml.h"
 #include "xmlfile.h"
@@ -34,7 +36,16 @@ static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, os
 		if (st->getName() == "score-timewise") return kUnsupported;
 		
 		xml2guidovisitor v(true, true, generateBars, partFilter);
-		Sguidoelement gmn = v.convert(st);
+		v.singlePass (true);
+		Sguidoelement gmn;
+		try {
+			gmn = v.convert(st);
+		}
+		catch (std::overflow_error& e) {
+			// the durations and positions can't be represented
+			cerr << "xml2guido: " << e.what() << endl;
+			return kUnsupported;
+		}
 		if (file) {
 			out << "(*\n  gmn code converted from '" << file << "'"
 				<< "\n  using libmusicxml v." << musicxmllibVersionStr();
@@ -51,7 +62,7 @@ static xmlErr xml2guido(SXMLFile& xmlfile, bool generateBars, int partFilter, os
 //_______________________________________________________________________________
 EXP xmlErr musicxmlfile2guido(const char *file, bool generateBars, ostream& out) 
 {
-	xmlreader r;
+	xmlreader r (true);
 	SXMLFile xmlfile;
 	xmlfile = r.read(file);
 	if (xmlfile) {
@@ -63,7 +74,7 @@ EXP xmlErr musicxmlfile2guido(const char *file, bool generateBars, ostream& out)
 //_______________________________________________________________________________
 EXP xmlErr musicxmlfd2guido(FILE * fd, bool generateBars, ostream& out) 
 {
-	xmlreader r;
+	xmlreader r (true);
 	SXMLFile xmlfile;
 	xmlfile = r.read(fd);
 	if (xmlfile) {
@@ -81,14 +92,43 @@ EXP xmlErr musicxmlstring2guido(const char * buffer, bool generateBars, ostream&
 
 EXP xmlErr musicxmlstring2guidoOnPart(const char * buffer, bool generateBars, int partFilter, std::ostream& out)
 {
-	xmlreader r;
+	xmlreader r (true);
 	SXMLFile xmlfile;
-	xmlfile = r.readbuff(buffer);
+	if (partFilter) {
+		// only the part-list and the requested part are parsed
+		stringstream id;
+		id << "P" << partFilter;
+		xmlfile = r.readpart(buffer, id.str());
+	}
+	else xmlfile = r.readbuff(buffer);
 	if (xmlfile) {
 		return xml2guido(xmlfile, generateBars, partFilter, out, 0);
 	}
 	return kInvalidFile;
 }
-    
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlmxlfile2guido(const char *file, bool generateBars, ostream& out) 
+{
+	xmlreader r (true);
+	SXMLFile xmlfile;
+	xmlfile = r.readmxl(file);
+	if (xmlfile) {
+		return xml2guido(xmlfile, generateBars, 0, out, file);
+	}
+	return kInvalidFile;
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlmxldata2guido(const char *data, size_t size, bool generateBars, ostream& out) 
+{
+	xmlreader r (true);
+	SXMLFile xmlfile;
+	xmlfile = r.readmxl(data, size);
+	if (xmlfile) {
+		return xml2guido(xmlfile, generateBars, 0, out, 0);
+	}
+	return kInvalidFile;
+}
 
 }
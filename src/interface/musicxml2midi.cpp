@@ -0,0 +1,80 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifdef MSVC
+# pragma warning (disable : 4786)
+#endif
+
+#include <iostream>
+#include <stdexcept>
+#include "libmusicxml.h"
+#include "xml.h"
+#include "xmlfile.h"
+#include "xmlreader.h"
+#include "midicontextvisitor.h"
+#include "midifile.h"
+#include "unrolled_xml_tree_browser.h"
+
+using namespace std;
+
+namespace MusicXML2 
+{
+
+//_______________________________________________________________________________
+static xmlErr xml2midi(SXMLFile& xmlfile, long tpq, ostream& out)
+{
+	Sxmlelement st = xmlfile->elements();
+	if (st) {
+		if (st->getName() == "score-timewise") return kUnsupported;
+
+		midifile mf (tpq);
+		midicontextvisitor v(tpq, &mf);
+		unrolled_xml_tree_browser browser(&v);
+		try {
+			browser.browse(*st);
+		}
+		catch (std::overflow_error& e) {
+			// the durations and positions can't be represented
+			cerr << "xml2midi: " << e.what() << endl;
+			return kUnsupported;
+		}
+		mf.write (out);
+		return kNoErr;
+	}
+	return kInvalidFile;
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlfile2midi(const char *file, long tpq, ostream& out) 
+{
+	xmlreader r (true);
+	SXMLFile xmlfile = r.read(file);
+	return xmlfile ? xml2midi(xmlfile, tpq, out) : kInvalidFile;
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlfd2midi(FILE * fd, long tpq, ostream& out) 
+{
+	xmlreader r (true);
+	SXMLFile xmlfile = r.read(fd);
+	return xmlfile ? xml2midi(xmlfile, tpq, out) : kInvalidFile;
+}
+
+//_______________________________________________________________________________
+EXP xmlErr musicxmlstring2midi(const char * buffer, long tpq, ostream& out) 
+{
+	xmlreader r (true);
+	SXMLFile xmlfile = r.readbuff(buffer);
+	return xmlfile ? xml2midi(xmlfile, tpq, out) : kInvalidFile;
+}
+
+}
@@ -15,6 +15,8 @@
 #endif
 
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 
 #include "xml.h"
 #include "xmlfile.h"
@@ -24,6 +26,8 @@
 
 #include "messagesHandling.h"
 
+#include "xml2lyOptionsHandling.h"
+
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
   #include "traceOptions.h"
@@ -79,8 +83,24 @@ S_msrScore buildMsrSkeletonFromElementsTree (
       logIOstream);
 
   // build the MSR score
-  skeletonBuilder.browseMxmlTree (
-    mxmlTree);
+  try {
+    skeletonBuilder.browseMxmlTree (
+      mxmlTree);
+  }
+  catch (std::overflow_error& e) {
+    // the positions and durations are rationals, see rational.h
+    stringstream s;
+
+    s <<
+      "the durations in this score can't be computed: " <<
+      e.what ();
+      
+    msrMusicXMLError (
+      gXml2lyOptions->fInputSourceName,
+      1, // inputLineNumber,
+      __FILE__, __LINE__,
+      s.str ());
+  }
 
   // fetch the score skeleton
   S_msrScore
@@ -90,7 +110,7 @@ S_msrScore buildMsrSkeletonFromElementsTree (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 2a",
     "build the MSR skeleton",
     timingItem::kMandatory,
@@ -140,7 +160,7 @@ void displayMsrSkeleton (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display the MSR skeleton",
     timingItem::kOptional,
@@ -191,7 +211,7 @@ void displayMsrSkeletonSummary (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display MSR skeleton summary",
     timingItem::kOptional,
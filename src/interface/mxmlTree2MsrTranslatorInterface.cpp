@@ -15,6 +15,8 @@
 #endif
 
 #include <iostream>
+#include <sstream>
+#include <stdexcept>
 
 #include "xml.h"
 #include "xmlfile.h"
@@ -22,6 +24,10 @@
 
 #include "versions.h"
 
+#include "messagesHandling.h"
+
+#include "xml2lyOptionsHandling.h"
+
 #include "setTraceOptionsIfDesired.h"
 #ifdef TRACE_OPTIONS
   #include "traceOptions.h"
@@ -84,13 +90,29 @@ void populateMsrSkeletonFromMxmlTree (
       logIOstream);
 
   // browse the mxmlTree
-  translator.browseMxmlTree (
-    mxmlTree);
+  try {
+    translator.browseMxmlTree (
+      mxmlTree);
+  }
+  catch (std::overflow_error& e) {
+    // the positions and durations are rationals, see rational.h
+    stringstream s;
+
+    s <<
+      "the durations in this score can't be computed: " <<
+      e.what ();
+      
+    msrMusicXMLError (
+      gXml2lyOptions->fInputSourceName,
+      1, // inputLineNumber,
+      __FILE__, __LINE__,
+      s.str ());
+  }
 
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "Pass 2b",
     "build the MSR",
     timingItem::kMandatory,
@@ -129,7 +151,7 @@ void displayMSRPopulatedScore (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display the MSR",
     timingItem::kOptional,
@@ -180,7 +202,7 @@ void displayMSRPopulatedScoreSummary (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display MSR summary",
     timingItem::kOptional,
@@ -231,7 +253,7 @@ void displayMSRPopulatedScoreNames (
   clock_t endClock = clock ();
 
   // register time spent
-  timing::gTiming.appendTimingItem (
+  gTiming.appendTimingItem (
     "",
     "display MSR names",
     timingItem::kOptional,
@@ -0,0 +1,81 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <stdlib.h>
+#include <new>
+
+#include "arena.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+// the header stored in front of each object allocated using arena::allocate (size, arena*)
+// its size preserves the alignment of the object
+typedef union {
+	arena*		fArena;
+	max_align_t	fAlign;
+} objheader;
+
+static const size_t kAlign = sizeof(max_align_t);
+static inline size_t align (size_t size)	{ return (size + kAlign - 1) & ~(kAlign - 1); }
+
+//______________________________________________________________________________
+Sarena arena::create()	{ arena * o = new arena; assert(o!=0); return o; }
+
+arena::~arena()
+{
+	for (vector<char*>::iterator i = fBlocks.begin(); i != fBlocks.end(); i++)
+		free (*i);
+}
+
+//______________________________________________________________________________
+void* arena::allocate (size_t size)
+{
+	size = align(size);
+	if (size > fFree) {
+		if (size > kBlockSize / 4) {		// large objects have their own block
+			char* block = (char*)malloc (size);
+			if (!block) throw bad_alloc();
+			fBlocks.push_back (block);
+			fAllocated += size;
+			return block;
+		}
+		fCurrent = (char*)malloc (kBlockSize);
+		if (!fCurrent) throw bad_alloc();
+		fBlocks.push_back (fCurrent);
+		fFree = kBlockSize;
+		fAllocated += kBlockSize;
+	}
+	void* ptr = fCurrent;
+	fCurrent += size;
+	fFree -= size;
+	return ptr;
+}
+
+//______________________________________________________________________________
+void* arena::allocate (size_t size, arena* a)
+{
+	objheader* h = (objheader*)a->allocate (size + sizeof(objheader));
+	h->fArena = a;
+	a->addReference();
+	return h + 1;
+}
+
+// the memory is released with the arena
+void arena::release (void* ptr)
+{
+	if (ptr) ((objheader*)ptr - 1)->fArena->removeReference();
+}
+
+}
@@ -0,0 +1,86 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __arena__
+#define __arena__
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+#include "exports.h"
+#include "smartpointer.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a memory arena for the nodes of a document
+
+	An arena allocates memory from large blocks and releases all the blocks
+	at once when it is destroyed. Memory given back to the arena is never
+	reused: an arena is intended for objects that share the same lifetime,
+	typically the elements and attributes of a document.
+\n	Each object allocated from an arena holds a reference on it, so that
+	the arena outlives its objects, even when they are still referenced
+	after the document has been released. The objects destructors still
+	run: the arena saves the allocation of the objects themselves, their
+	strings and vectors are allocated from the heap.
+*/
+class EXP arena : public smartable {
+	private:
+		std::vector<char*>	fBlocks;	///< the allocated blocks
+		char*				fCurrent;	///< the next free location in the current block
+		size_t				fFree;		///< the free space in the current block
+		size_t				fAllocated;	///< the total allocated size (for information)
+
+	protected:
+				 arena() : fCurrent(0), fFree(0), fAllocated(0) {}
+		virtual ~arena();
+
+	public:
+		enum { kBlockSize = 64*1024 };
+
+		static SMARTP<arena> create();
+
+		//! allocates size bytes from the arena (suitably aligned)
+		void*	allocate (size_t size);
+		//! gives the total memory allocated from the arena
+		size_t	allocated () const		{ return fAllocated; }
+
+		//! allocates memory for an object from the arena a, which the object keeps alive
+		static void*	allocate (size_t size, arena* a);
+		//! releases memory allocated using allocate (size, arena*)
+		static void		release (void* ptr);
+};
+typedef SMARTP<arena> Sarena;
+
+/*!
+\brief a T allocated from an arena
+
+	The objects are allocated from an arena using new (arena) inarena<T>(...)
+	and released by the regular delete operator, which requires a virtual
+	destructor. Only these objects pay for the reference on their arena:
+	the T allocated from the heap are left as they are.
+*/
+template <typename T> class inarena : public T {
+	public:
+		template <typename... Args>
+				 inarena (Args&&... args) : T(std::forward<Args>(args)...) {}
+
+		static void* operator new (size_t size, arena* a)			{ return arena::allocate (size, a); }
+		static void  operator delete (void* ptr)					{ arena::release (ptr); }
+		static void  operator delete (void* ptr, arena*)			{ arena::release (ptr); }
+};
+
+}
+
+#endif
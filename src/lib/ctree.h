@@ -17,6 +17,7 @@
 #include <stack>
 #include <vector>
 #include <iterator>
+#include <utility>
 
 #ifdef WIN32
 #pragma warning (disable : 4251)
@@ -47,7 +48,11 @@ template <typename T> class EXP treeIterator : public std::iterator<std::input_i
 					 else forward_down (t);
 				 }
 				 treeIterator(const treeIterator& a)  { *this = a; }
+				 treeIterator(treeIterator&& a) = default;
 		virtual ~treeIterator() {}
+
+		treeIterator& operator =(const treeIterator& a) = default;
+		treeIterator& operator =(treeIterator&& a) = default;
 		
 		T operator  *() const	{ return *fCurrentIterator; }
 		T operator ->() const	{ return *fCurrentIterator; } 
@@ -67,7 +72,7 @@ template <typename T> class EXP treeIterator : public std::iterator<std::input_i
 		// current element is empty: go up to parent element and possibly down to neighbor element
 		void forward_up() {
 			while (fStack.size()) {
-				state s = fStack.top();
+				state s = std::move(fStack.top());
 				fStack.pop();
 
 				fCurrentIterator = s.first;
@@ -91,6 +96,7 @@ template <typename T> class EXP treeIterator : public std::iterator<std::input_i
 		treeIterator& erase() {
 			T parent = getParent();
 			fCurrentIterator = parent->elements().erase(fCurrentIterator);
+			parent->modified();
 			if (fStack.size()) fStack.pop();
 			if (fCurrentIterator != parent->elements().end()) {
 				fStack.push( make_pair(fCurrentIterator+1, parent));
@@ -103,6 +109,7 @@ template <typename T> class EXP treeIterator : public std::iterator<std::input_i
 		treeIterator& insert(const T& value) {
 			T parent = getParent();
 			fCurrentIterator = parent->elements().insert(fCurrentIterator, value);
+			parent->modified();
 			if (fStack.size()) fStack.pop();
 			fStack.push( make_pair(fCurrentIterator+1, parent));
 			return *this;
@@ -132,7 +139,10 @@ template <typename T> class EXP ctree : virtual public smartable
 		
 		branchs& elements()						{ return fElements; }		
 		const branchs& elements() const			{ return fElements; }		
-		virtual void push (const treePtr& t)	{ fElements.push_back(t); }
+		virtual void push (const treePtr& t)	{ fElements.push_back(t); modified(); }
+		virtual void push (treePtr&& t)			{ fElements.push_back(std::move(t)); modified(); }
+		//! called when the node or its sub elements list has changed (the changes made using elements() are not notified)
+		virtual void modified ()				{}
 		virtual int  size  () const				{ return int(fElements.size()); }
 		virtual bool empty () const				{ return fElements.size()==0; }
 
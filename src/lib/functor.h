@@ -23,6 +23,13 @@ class functor {
 		virtual R operator ()() = 0;
 };
 
+template <typename R, typename A1, typename A2>
+class functor2 {
+	public:
+		virtual ~functor2() {}
+		virtual R operator ()(A1 arg1, A2 arg2) = 0;
+};
+
 }
 
 #endif
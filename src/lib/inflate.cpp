@@ -0,0 +1,293 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <string.h>
+
+#include "inflate.h"
+
+namespace MusicXML2
+{
+
+enum { kMaxBits = 15, kMaxLCodes = 286, kMaxDCodes = 30, kFixLCodes = 288 };
+
+//______________________________________________________________________________
+// a canonical huffman code: the number of symbols of each length
+// and the symbols ordered by code
+struct huffman {
+	short	count[kMaxBits+1];
+	short	symbol[kFixLCodes];
+};
+
+// thrown on invalid or truncated data, caught by inflater::inflate
+struct inflateError {};
+
+//______________________________________________________________________________
+// the decoder state
+class decoder {
+	const unsigned char*	fIn;
+	size_t					fInSize, fInPos;
+	unsigned char*			fOut;
+	size_t					fOutSize, fOutPos;
+	unsigned long			fBitBuf;	// the pending input bits
+	int						fBitCount;	// the number of pending bits
+
+	int		bits	(int need);
+	int		decode	(const huffman& h);
+	void	stored	();
+	void	codes	(const huffman& lencode, const huffman& distcode);
+	void	fixed	();
+	void	dynamic	();
+
+	public:
+		decoder (const unsigned char* in, size_t insize, unsigned char* out, size_t outsize)
+			: fIn(in), fInSize(insize), fInPos(0), fOut(out), fOutSize(outsize), fOutPos(0), fBitBuf(0), fBitCount(0) {}
+
+		bool	run ();
+};
+
+//______________________________________________________________________________
+// builds a huffman code from the code lengths of the symbols
+// returns 0 for a complete code, a positive value for an incomplete code
+// and a negative value for an over-subscribed code
+static int build (huffman& h, const short* length, int n)
+{
+	for (int len = 0; len <= kMaxBits; len++) h.count[len] = 0;
+	for (int symbol = 0; symbol < n; symbol++) h.count[length[symbol]]++;
+	if (h.count[0] == n) return 0;		// no codes: complete, but decoding will fail
+
+	int left = 1;
+	for (int len = 1; len <= kMaxBits; len++) {
+		left <<= 1;
+		left -= h.count[len];
+		if (left < 0) return left;
+	}
+
+	short offs[kMaxBits+1];
+	offs[1] = 0;
+	for (int len = 1; len < kMaxBits; len++) offs[len + 1] = offs[len] + h.count[len];
+	for (int symbol = 0; symbol < n; symbol++)
+		if (length[symbol]) h.symbol[offs[length[symbol]]++] = short(symbol);
+	return left;
+}
+
+//______________________________________________________________________________
+int decoder::bits (int need)
+{
+	while (fBitCount < need) {
+		if (fInPos >= fInSize) throw inflateError();
+		fBitBuf |= (unsigned long)fIn[fInPos++] << fBitCount;
+		fBitCount += 8;
+	}
+	int val = int(fBitBuf & ((1UL << need) - 1));
+	fBitBuf >>= need;
+	fBitCount -= need;
+	return val;
+}
+
+//______________________________________________________________________________
+// decodes a symbol: the codes are compared bit by bit to the first code of each length
+int decoder::decode (const huffman& h)
+{
+	int code = 0, first = 0, index = 0;
+	for (int len = 1; len <= kMaxBits; len++) {
+		if (!fBitCount) {
+			if (fInPos >= fInSize) throw inflateError();
+			fBitBuf = fIn[fInPos++];
+			fBitCount = 8;
+		}
+		code |= int(fBitBuf & 1);
+		fBitBuf >>= 1;
+		fBitCount--;
+		int count = h.count[len];
+		if (code - count < first) return h.symbol[index + (code - first)];
+		index += count;
+		first += count;
+		first <<= 1;
+		code <<= 1;
+	}
+	throw inflateError();
+}
+
+//______________________________________________________________________________
+void decoder::stored ()
+{
+	fBitBuf = 0;		// stored blocks start on a byte boundary
+	fBitCount = 0;
+	if (fInPos + 4 > fInSize) throw inflateError();
+	size_t len = fIn[fInPos] | (fIn[fInPos+1] << 8);
+	size_t nlen = fIn[fInPos+2] | (fIn[fInPos+3] << 8);
+	fInPos += 4;
+	if (len != (~nlen & 0xffff)) throw inflateError();
+	if ((fInPos + len > fInSize) || (fOutPos + len > fOutSize)) throw inflateError();
+	memcpy (fOut + fOutPos, fIn + fInPos, len);
+	fInPos += len;
+	fOutPos += len;
+}
+
+//______________________________________________________________________________
+void decoder::codes (const huffman& lencode, const huffman& distcode)
+{
+	static const short lbase[29] = {
+		3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+		35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+	static const short lext[29] = {
+		0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+		3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+	static const short dbase[30] = {
+		1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+		257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145,
+		8193, 12289, 16385, 24577 };
+	static const short dext[30] = {
+		0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+		7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+	for (;;) {
+		int symbol = decode (lencode);
+		if (symbol < 256) {					// literal
+			if (fOutPos >= fOutSize) throw inflateError();
+			fOut[fOutPos++] = (unsigned char)symbol;
+		}
+		else if (symbol == 256) return;		// end of block
+		else {								// length and distance of a copy
+			symbol -= 257;
+			if (symbol >= 29) throw inflateError();
+			size_t len = lbase[symbol] + bits (lext[symbol]);
+			symbol = decode (distcode);
+			if (symbol >= 30) throw inflateError();
+			size_t dist = dbase[symbol] + bits (dext[symbol]);
+			if ((dist > fOutPos) || (fOutPos + len > fOutSize)) throw inflateError();
+			// byte by byte: the source and the destination may overlap
+			const unsigned char* from = fOut + fOutPos - dist;
+			unsigned char* to = fOut + fOutPos;
+			for (size_t i = 0; i < len; i++) to[i] = from[i];
+			fOutPos += len;
+		}
+	}
+}
+
+//______________________________________________________________________________
+void decoder::fixed ()
+{
+	huffman lencode, distcode;
+	short lengths[kFixLCodes];
+	int symbol = 0;
+	for (; symbol < 144; symbol++) lengths[symbol] = 8;
+	for (; symbol < 256; symbol++) lengths[symbol] = 9;
+	for (; symbol < 280; symbol++) lengths[symbol] = 7;
+	for (; symbol < kFixLCodes; symbol++) lengths[symbol] = 8;
+	build (lencode, lengths, kFixLCodes);
+	for (symbol = 0; symbol < kMaxDCodes; symbol++) lengths[symbol] = 5;
+	build (distcode, lengths, kMaxDCodes);
+	codes (lencode, distcode);
+}
+
+//______________________________________________________________________________
+void decoder::dynamic ()
+{
+	static const short order[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+	int nlen = bits (5) + 257;
+	int ndist = bits (5) + 1;
+	int ncode = bits (4) + 4;
+	if ((nlen > kMaxLCodes) || (ndist > kMaxDCodes)) throw inflateError();
+
+	// the code lengths of the code lengths code
+	short lengths[kMaxLCodes + kMaxDCodes];
+	int index = 0;
+	for (; index < ncode; index++) lengths[order[index]] = short(bits (3));
+	for (; index < 19; index++) lengths[order[index]] = 0;
+
+	huffman lencode, distcode;
+	if (build (lencode, lengths, 19) != 0) throw inflateError();
+
+	// the literal/length and distance code lengths
+	index = 0;
+	while (index < nlen + ndist) {
+		int symbol = decode (lencode);
+		if (symbol < 16) lengths[index++] = short(symbol);
+		else {
+			short len = 0;
+			int repeat;
+			if (symbol == 16) {
+				if (index == 0) throw inflateError();
+				len = lengths[index - 1];
+				repeat = 3 + bits (2);
+			}
+			else if (symbol == 17) repeat = 3 + bits (3);
+			else repeat = 11 + bits (7);
+			if (index + repeat > nlen + ndist) throw inflateError();
+			while (repeat--) lengths[index++] = len;
+		}
+	}
+	if (lengths[256] == 0) throw inflateError();		// no end of block code
+
+	// incomplete codes are only allowed for a single length code
+	int err = build (lencode, lengths, nlen);
+	if ((err < 0) || ((err > 0) && (nlen - lencode.count[0] != 1))) throw inflateError();
+	err = build (distcode, lengths + nlen, ndist);
+	if ((err < 0) || ((err > 0) && (ndist - distcode.count[0] != 1))) throw inflateError();
+	codes (lencode, distcode);
+}
+
+//______________________________________________________________________________
+bool decoder::run ()
+{
+	try {
+		int last;
+		do {
+			last = bits (1);
+			switch (bits (2)) {
+				case 0:	stored();	break;
+				case 1:	fixed();	break;
+				case 2:	dynamic();	break;
+				default: return false;
+			}
+		} while (!last);
+	}
+	catch (inflateError&) {
+		return false;
+	}
+	return fOutPos == fOutSize;
+}
+
+//______________________________________________________________________________
+bool inflater::inflate (const unsigned char* in, size_t insize, unsigned char* out, size_t outsize)
+{
+	decoder d (in, insize, out, outsize);
+	return d.run();
+}
+
+//______________________________________________________________________________
+// the crc table, computed on first use (thread safe initialization of a local static)
+struct crctable {
+	unsigned long	fValues[256];
+	crctable () {
+		for (unsigned long n = 0; n < 256; n++) {
+			unsigned long c = n;
+			for (int k = 0; k < 8; k++)
+				c = (c & 1) ? 0xedb88320UL ^ (c >> 1) : c >> 1;
+			fValues[n] = c;
+		}
+	}
+};
+
+unsigned long inflater::crc32 (const unsigned char* data, size_t size)
+{
+	static const crctable crc32table;
+	const unsigned long* table = crc32table.fValues;
+	unsigned long crc = 0xffffffffUL;
+	for (size_t i = 0; i < size; i++)
+		crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+	return crc ^ 0xffffffffUL;
+}
+
+}
@@ -0,0 +1,46 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __inflate__
+#define __inflate__
+
+#include <cstddef>
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a decoder for the deflate compressed data format (RFC 1951)
+
+	Decodes raw deflate data, as stored in zip archives, into a buffer
+	allocated by the caller. The size of the decoded data must be known
+	in advance, which is the case for the entries of a zip archive.
+*/
+class EXP inflater {
+	public:
+		/*! \brief decodes deflate data
+			\param in the compressed data
+			\param insize the size of the compressed data
+			\param out the output buffer
+			\param outsize the expected size of the decoded data
+			\return true when the data decodes to exactly outsize bytes
+		*/
+		static bool	inflate (const unsigned char* in, size_t insize, unsigned char* out, size_t outsize);
+
+		//! computes the crc-32 checksum of a buffer, as used by zip archives
+		static unsigned long crc32 (const unsigned char* data, size_t size);
+};
+
+}
+
+#endif
@@ -0,0 +1,106 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include <algorithm>
+#include <string.h>
+
+#include "perfecthash.h"
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+static size_t pow2 (size_t n)		{ size_t p = 1; while (p < n) p <<= 1; return p; }
+
+//______________________________________________________________________________
+// FNV-1a followed by a final avalanche, so that the low bits can be used as an index
+unsigned int perfecthash::hash (const char* key, size_t length, unsigned int seed)
+{
+	unsigned int h = 2166136261U ^ (seed * 0x9e3779b9U);
+	for (size_t i = 0; i < length; i++) {
+		h ^= (unsigned char)key[i];
+		h *= 16777619U;
+	}
+	h ^= h >> 16;
+	h *= 0x85ebca6bU;
+	h ^= h >> 13;
+	h *= 0xc2b2ae35U;
+	h ^= h >> 16;
+	return h;
+}
+
+//______________________________________________________________________________
+void perfecthash::build (const vector<string>& keys)
+{
+	fKeys = keys;
+	size_t count = 0;
+	for (size_t i = 0; i < keys.size(); i++)
+		if (!keys[i].empty()) count++;
+
+	size_t nbuckets = pow2 ((count + 1) / 2);
+	size_t nslots = pow2 (count * 2);
+	fSeeds.assign (nbuckets, 0);
+	fSlots.assign (nslots, -1);
+
+	// distributes the keys in buckets, duplicated keys are ignored
+	vector<vector<int> > buckets (nbuckets);
+	for (size_t i = 0; i < keys.size(); i++) {
+		const string& key = keys[i];
+		if (key.empty()) continue;
+		vector<int>& bucket = buckets[hash (key.c_str(), key.size(), 0) & (nbuckets - 1)];
+		bool duplicate = false;
+		for (size_t j = 0; j < bucket.size(); j++)
+			if (keys[bucket[j]] == key) duplicate = true;
+		if (!duplicate) bucket.push_back (int(i));
+	}
+
+	// the larger buckets are placed first, while the table is mostly free
+	vector<size_t> order (nbuckets);
+	for (size_t b = 0; b < nbuckets; b++) order[b] = b;
+	stable_sort (order.begin(), order.end(), [&buckets](size_t a, size_t b) { return buckets[a].size() > buckets[b].size(); });
+
+	vector<size_t> slots;
+	for (size_t n = 0; n < nbuckets; n++) {
+		size_t b = order[n];
+		const vector<int>& bucket = buckets[b];
+		if (bucket.empty()) break;
+		for (unsigned int seed = 1; ; seed++) {
+			slots.clear();
+			for (size_t i = 0; i < bucket.size(); i++) {
+				const string& key = keys[bucket[i]];
+				size_t slot = hash (key.c_str(), key.size(), seed) & (nslots - 1);
+				if ((fSlots[slot] >= 0) || (std::find (slots.begin(), slots.end(), slot) != slots.end())) break;
+				slots.push_back (slot);
+			}
+			if (slots.size() == bucket.size()) {
+				for (size_t i = 0; i < bucket.size(); i++)
+					fSlots[slots[i]] = bucket[i];
+				fSeeds[b] = seed;
+				break;
+			}
+		}
+	}
+}
+
+//______________________________________________________________________________
+int perfecthash::find (const char* key, size_t length) const
+{
+	if (fSlots.empty()) return -1;
+	unsigned int seed = fSeeds[hash (key, length, 0) & (fSeeds.size() - 1)];
+	int index = fSlots[hash (key, length, seed) & (fSlots.size() - 1)];
+	if (index < 0) return -1;
+	const string& candidate = fKeys[index];
+	return ((candidate.size() == length) && !memcmp (candidate.data(), key, length)) ? index : -1;
+}
+
+}
@@ -0,0 +1,56 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef __perfecthash__
+#define __perfecthash__
+
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "exports.h"
+
+namespace MusicXML2
+{
+
+/*!
+\brief a minimal perfect hash of a fixed set of strings
+
+	Maps each string of a set, known at build time, to its index in the set.
+	A lookup computes two hashes of the key and makes a single comparison,
+	whatever the size of the set.
+\n	The table is built using the 'hash and displace' method: the keys are
+	first distributed in buckets, then a seed is searched for each bucket
+	so that its keys fall into free slots.
+*/
+class EXP perfecthash {
+	private:
+		std::vector<unsigned int>	fSeeds;		///< the seeds of the buckets
+		std::vector<int>			fSlots;		///< the index of the key stored in each slot, -1 when free
+		std::vector<std::string>	fKeys;		///< the keys
+
+		static unsigned int hash (const char* key, size_t length, unsigned int seed);
+
+	public:
+				 perfecthash() {}
+		virtual ~perfecthash() {}
+
+		//! builds the table for a set of distinct keys, empty keys are ignored
+		void	build (const std::vector<std::string>& keys);
+
+		//! returns the index of a key or -1 when the key is not part of the set
+		int		find (const char* key, size_t length) const;
+		int		find (const std::string& key) const		{ return find (key.c_str(), key.size()); }
+};
+
+}
+
+#endif
@@ -12,10 +12,70 @@
 
 #include "rational.h"
 #include <sstream>
+#include <stdexcept>
+#include <climits>
 #include <cmath>
 #include <stdlib.h>
 #include <string.h>
 
+//______________________________________________________________________________
+// overflow checked long int arithmetic
+static void overflow ()
+{
+	throw std::overflow_error("rational: long int overflow");
+}
+
+static inline long int checkedAdd (long int a, long int b)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	long int r;
+	if (__builtin_add_overflow(a, b, &r)) overflow();
+	return r;
+#else
+	if ((b > 0) ? (a > LONG_MAX - b) : (a < LONG_MIN - b)) overflow();
+	return a + b;
+#endif
+}
+
+static inline long int checkedSub (long int a, long int b)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	long int r;
+	if (__builtin_sub_overflow(a, b, &r)) overflow();
+	return r;
+#else
+	if ((b < 0) ? (a > LONG_MAX + b) : (a < LONG_MIN + b)) overflow();
+	return a - b;
+#endif
+}
+
+static inline bool mulOverflows (long int a, long int b, long int& r)
+{
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_mul_overflow(a, b, &r);
+#else
+	if (a && b) {
+		if (a > 0) {
+			if (b > 0) { if (a > LONG_MAX / b) return true; }
+			else if (b < LONG_MIN / a) return true;
+		}
+		else {
+			if (b > 0) { if (a < LONG_MIN / b) return true; }
+			else if (b < LONG_MAX / a) return true;
+		}
+	}
+	r = a * b;
+	return false;
+#endif
+}
+
+static inline long int checkedMul (long int a, long int b)
+{
+	long int r;
+	if (mulOverflows(a, b, r)) overflow();
+	return r;
+}
+
 //______________________________________________________________________________
 rational::rational (const string &str)
 {
@@ -24,14 +84,12 @@ rational::rational (const string &str)
     const char *denom;
     denom = strstr(cstr,"/");
     if (denom) ++denom;
-    fNumerator = atol(cstr);
-    if (denom) fDenominator = atol(denom);
+    set (atol(cstr), denom ? atol(denom) : 1);
 }
 
-rational::rational(long int num, long int denom) : fNumerator(num), fDenominator(denom)
+rational::rational(long int num, long int denom)
 {
-    // don't allow zero denominators!
-    if (fDenominator == 0) fDenominator = 1;
+	set (num, denom);
 }
 
 rational::rational(const rational& d)
@@ -40,65 +98,103 @@ rational::rational(const rational& d)
     fDenominator = d.fDenominator;
 }
 
+void rational::set(long int n, long int d)
+{
+    // don't allow zero denominators!
+    if (d == 0) d = 1;
+    // keep the sign in the numerator
+    if (d < 0) {
+		n = checkedSub(0, n);
+		d = checkedSub(0, d);
+	}
+	fNumerator = n;
+	fDenominator = d;
+}
+
 //______________________________________________________________________________
+rational rational::reduced (long int num, long int denom)
+{
+	rational r;
+	if (denom == 1) {
+		r.fNumerator = num;
+		return r;
+	}
+	long int g = gcd (num, denom);
+	r.set (num / g, denom / g);
+	return r;
+}
+
 rational rational::operator +(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator + dur.fNumerator * fDenominator, fDenominator * dur.fDenominator);
+	// cheap case: same denominators
+	if (fDenominator == dur.fDenominator)
+		return reduced (checkedAdd(fNumerator, dur.fNumerator), fDenominator);
+	// keep the intermediate results small
+	long int g = gcd (fDenominator, dur.fDenominator);
+	long int b = fDenominator / g;
+	long int d = dur.fDenominator / g;
+	return reduced (checkedAdd(checkedMul(fNumerator, d), checkedMul(dur.fNumerator, b)), checkedMul(fDenominator, d));
 }
 
 rational rational::operator -(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator - dur.fNumerator * fDenominator, fDenominator * dur.fDenominator);
+	if (fDenominator == dur.fDenominator)
+		return reduced (checkedSub(fNumerator, dur.fNumerator), fDenominator);
+	long int g = gcd (fDenominator, dur.fDenominator);
+	long int b = fDenominator / g;
+	long int d = dur.fDenominator / g;
+	return reduced (checkedSub(checkedMul(fNumerator, d), checkedMul(dur.fNumerator, b)), checkedMul(fDenominator, d));
 }
 
 rational rational::operator *(const rational &dur) const {
-    return rational(fNumerator * dur.fNumerator, fDenominator * dur.fDenominator);
+	// cross cancel first to keep the intermediate results small
+	long int g1 = gcd (fNumerator, dur.fDenominator);
+	long int g2 = gcd (dur.fNumerator, fDenominator);
+	return reduced (checkedMul(fNumerator / g1, dur.fNumerator / g2), checkedMul(fDenominator / g2, dur.fDenominator / g1));
 }
 
 rational rational::operator /(const rational &dur) const {
-    return rational(fNumerator * dur.fDenominator, fDenominator * dur.fNumerator);
+	// a zero divisor gives a zero denominator, that becomes 1 as in set ()
+	if (dur.fNumerator == 0) return rational(checkedMul(fNumerator, dur.fDenominator));
+	return *this * rational(dur.fDenominator, dur.fNumerator);
 }
 
 rational rational::operator *(int num) const {
-	return rational(fNumerator * num, fDenominator);
+	return *this * rational(num);
 }
 
 rational rational::operator /(int num) const {
-	return rational(fNumerator, fDenominator * num);
+	if (num == 0) return rational(fNumerator);
+	return *this * rational(1, num);
 }
 
 rational& rational::operator +=(const rational &dur)
 {
-    if(fDenominator == dur.fDenominator) {
-		fNumerator += dur.fNumerator;
-	} else {
-		fNumerator = fNumerator * dur.fDenominator + dur.fNumerator * fDenominator;
-		fDenominator *= dur.fDenominator;
-	}
-    return (*this);
+	return *this = *this + dur;
 }
 
 rational& rational::operator -=(const rational &dur)
 {
-	if(fDenominator == dur.fDenominator) {
-		fNumerator -= dur.fNumerator;
-	} else {
-		fNumerator = fNumerator * dur.fDenominator - dur.fNumerator * fDenominator;
-		fDenominator *= dur.fDenominator;
-    }
-	return (*this);
+	return *this = *this - dur;
 }
 
 rational& rational::operator *=(const rational &dur)
 {
-    fNumerator   *= dur.fNumerator;
-    fDenominator *= dur.fDenominator;
-    return (*this);
+	return *this = *this * dur;
 }
 
 rational& rational::operator /=(const rational &dur)
 {
-    fNumerator   *= dur.fDenominator;
-    fDenominator *= dur.fNumerator;
-    return (*this);
+	return *this = *this / dur;
+}
+
+rational& rational::operator *=(long int num)
+{
+	return *this = *this * rational(num);
+}
+
+rational& rational::operator /=(long int num)
+{
+	if (num == 0) return *this = rational(fNumerator);
+	return *this = *this * rational(1, num);
 }
 
 rational& rational::operator = (const rational& rat) {
@@ -108,22 +204,39 @@ rational& rational::operator = (const rational& rat) {
 }
 
 //______________________________________________________________________________
+int rational::compare (long int a, long int b, long int c, long int d)
+{
+	if (b == d) return (a < c) ? -1 : (a > c) ? 1 : 0;
+
+	// a/b < c/d if and only if a * d < b * c.
+	long int ad, bc;
+	if (!mulOverflows(a, d, ad) && !mulOverflows(b, c, bc))
+		return (ad < bc) ? -1 : (ad > bc) ? 1 : 0;
+
+	// otherwise compare the integral parts, then the fractional parts:
+	// r1/b < r2/d if and only if d/r2 < b/r1
+	long int q1 = a / b, r1 = a % b;
+	if (r1 < 0) { q1--; r1 += b; }
+	long int q2 = c / d, r2 = c % d;
+	if (r2 < 0) { q2--; r2 += d; }
+	if (q1 != q2) return (q1 < q2) ? -1 : 1;
+	if (r1 == 0 || r2 == 0) return (r1 == r2) ? 0 : (r1 == 0) ? -1 : 1;
+	return compare (d, r2, b, r1);
+}
+
 bool rational::operator > (const rational &rat) const
 {
-  // a/b > c/d if and only if a * d > b * c.
-  return ((fNumerator * rat.fDenominator) > (fDenominator * rat.fNumerator));
+  return compare (fNumerator, fDenominator, rat.fNumerator, rat.fDenominator) > 0;
 }
 
 bool rational::operator < (const rational &rat) const
 {
-  // a/b < c/d if and only if a * d < b * c.
-  return ((fNumerator * rat.fDenominator) < (fDenominator * rat.fNumerator));
+  return compare (fNumerator, fDenominator, rat.fNumerator, rat.fDenominator) < 0;
 }
 
 bool rational::operator == (const rational &rat) const
 {
-  // a/b < c/d if and only if a * d < b * c.
-	return ((fNumerator * rat.fDenominator) == (fDenominator * rat.fNumerator));
+	return compare (fNumerator, fDenominator, rat.fNumerator, rat.fDenominator) == 0;
 }
 
 bool rational::operator > (double num) const 	{ return (toDouble() > num); }
@@ -138,20 +251,24 @@ long int rational::gcd (long int a1, long int b1)
 {
   long int r;
 
-  long int a = labs(a1);
-  long int b = labs(b1);
-
-  if (! (a == 0) || (b == 0)) {
-    while (b > 0){
-      r = a % b;
-      a = b;
-      b = r;
-    } // while
-    
-    return a;
-  }
-  
-  return 1;
+  long int a = (a1 < 0) ? -a1 : a1;
+  long int b = (b1 < 0) ? -b1 : b1;
+
+  while (b > 0){
+    r = a % b;
+    a = b;
+    b = r;
+  } // while
+
+  // gcd (0, 0) is taken as 1, to divide by it safely
+  return a ? a : 1;
+}
+
+long int rational::lcm (long int a, long int b)
+{
+  if ((a == 0) || (b == 0)) return 0;
+  long int l = checkedMul (a / gcd (a, b), b);
+  return (l < 0) ? checkedSub (0, l) : l;
 }
 
 //______________________________________________________________________________
@@ -166,6 +283,21 @@ void rational::rationalise ()
     fDenominator = 1;
 }
 
+//______________________________________________________________________________
+bool rational::toTicks (long int ticksPerWhole, long int& ticks) const
+{
+  long int mul;
+  if (mulOverflows (fNumerator, ticksPerWhole, mul) || (mul % fDenominator))
+    return false;
+  ticks = mul / fDenominator;
+  return true;
+}
+
+rational rational::fromTicks (long int ticks, long int ticksPerWhole)
+{
+  return reduced (ticks, ticksPerWhole);
+}
+
 //______________________________________________________________________________
 double rational::toDouble() const
 {
@@ -20,6 +20,13 @@ using namespace std;
 
 /*!
 \brief	Rational number representation.
+
+	A rational built from a numerator and a denominator keeps them as written
+	(e.g. a 6/8 time signature or a 6:4 time modification), with a positive
+	denominator. The results of the arithmetic operators are always in lowest
+	terms, and comparisons are exact.
+	The arithmetic throws std::overflow_error when a result in lowest terms
+	doesn't fit in a long int, instead of silently wrapping around.
 */
 
 class EXP rational {
@@ -30,7 +37,12 @@ class EXP rational {
         long int fDenominator;        
         
         // Used by rationalise()
-        long int gcd(long int a, long int b); 
+        static long int gcd(long int a, long int b);
+
+		// the rational num/denom in lowest terms
+		static rational reduced(long int num, long int denom);
+		// -1, 0 or 1 as a/b is less, equal or greater than c/d (b, d > 0)
+		static int compare(long int a, long int b, long int c, long int d);
  
     public:    
 	
@@ -41,8 +53,8 @@ class EXP rational {
         long int getNumerator()	const		{ return fNumerator; }
         long int getDenominator() const		{ return fDenominator; }
         void setNumerator(long int d)		{ fNumerator = d; }
-        void setDenominator(long int d) 	{ fDenominator = d; }
-		void set(long int n, long int d)  { fNumerator = n; fDenominator = d; }
+        void setDenominator(long int d) 	{ set (fNumerator, d); }
+		void set(long int n, long int d);
 
         rational operator +(const rational &dur) const;
         rational operator -(const rational &dur) const;
@@ -61,8 +73,8 @@ class EXP rational {
         rational& operator /=(const rational &dur);
         // (i.e. dur * 3/2 or dur * 7/4)
 
-        rational& operator *=(long int num) { fNumerator *= num; return *this; }
-        rational& operator /=(long int num) { fDenominator *= num; return *this; }
+        rational& operator *=(long int num);
+        rational& operator /=(long int num);
  
         rational& operator =(const rational& dur);
     
@@ -82,6 +94,15 @@ class EXP rational {
 
         // Used to "rationalise" rational.
         void rationalise();
+
+		//! the value as a whole number of ticks, \c ticksPerWhole ticks making a whole note.
+		//! Returns false when the value is not a whole number of ticks.
+		bool toTicks(long int ticksPerWhole, long int& ticks) const;
+		//! the value of a number of ticks, \c ticksPerWhole ticks making a whole note
+		static rational fromTicks(long int ticks, long int ticksPerWhole);
+		//! the least common multiple of a and b, e.g. to compute the ticks per whole note
+		//! that represent exactly all the durations of a part
+		static long int lcm(long int a, long int b);
     	void print (ostream& os) const;
 
         operator string () const;
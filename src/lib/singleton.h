@@ -13,7 +13,8 @@
 #ifndef __singleton__
 #define __singleton__
 
-// warning: this is NOT a thread safe implementation
+// the instance initialization is thread safe (C++11 static local variables)
+// but the singleton itself is not protected: it should be immutable once built
 template <typename T> class singleton {
 	public:
 		static T& instance () {
@@ -56,10 +56,17 @@ class EXP smartable {
 	methods in a consistent way).
 */
 template<class T> class SMARTP {
+	template<class T2> friend class SMARTP;
+	template<class T2> friend class borrowed;
+
 	private:
 		//! the actual pointer to the class
 		T* fSmartPtr;
 
+		struct noreference {};
+		//! a smart pointer that doesn't maintain the object reference count (see borrowed::ref)
+		SMARTP(T* rawptr, noreference) : fSmartPtr(rawptr) {}
+
 	public:
 		//! an empty constructor - points to null
 		SMARTP()	: fSmartPtr(0) {}
@@ -70,6 +77,11 @@ template<class T> class SMARTP {
 		SMARTP(const SMARTP<T2>& ptr) : fSmartPtr((T*)ptr) { if (fSmartPtr) fSmartPtr->addReference(); }
 		//! build a smart pointer from another smart pointer reference
 		SMARTP(const SMARTP& ptr) : fSmartPtr((T*)ptr)     { if (fSmartPtr) fSmartPtr->addReference(); }
+		//! move constructor: takes over the reference of ptr, leaving ptr null
+		SMARTP(SMARTP&& ptr) noexcept : fSmartPtr(ptr.fSmartPtr)	{ ptr.fSmartPtr = 0; }
+		//! move constructor from a convertible class smart pointer
+		template<class T2>
+		SMARTP(SMARTP<T2>&& ptr) : fSmartPtr((T*)ptr.fSmartPtr)	{ ptr.fSmartPtr = 0; }
 
 		//! the smart pointer destructor: simply removes one reference count
 		~SMARTP()  { if (fSmartPtr) fSmartPtr->removeReference(); }
@@ -110,12 +122,73 @@ template<class T> class SMARTP {
 		}
 		//! operator = to support inherited class reference
 		SMARTP& operator=(const SMARTP<T>& p_)                { return operator=((T *) p_); }
+		//! move assignment: takes over the reference of p_, leaving p_ null
+		SMARTP& operator=(SMARTP<T>&& p_) noexcept {
+			if (this != &p_) {
+				T* old = fSmartPtr;
+				fSmartPtr = p_.fSmartPtr;
+				p_.fSmartPtr = 0;
+				if (old) old->removeReference();
+			}
+			return *this;
+		}
 		//! dynamic cast support
 		template<class T2> SMARTP& cast(T2* p_)               { return operator=(dynamic_cast<T*>(p_)); }
 		//! dynamic cast support
 		template<class T2> SMARTP& cast(const SMARTP<T2>& p_) { return operator=(dynamic_cast<T*>(p_)); }
 		//! operator < (require by VC6 for maps)
-		bool operator < (const SMARTP<T>& p_) const			  { return (void*)this < (void*)p_; }
+		bool operator < (const SMARTP<T>& p_) const			  { return fSmartPtr < p_.fSmartPtr; }
+};
+
+/*!
+\brief a non owning pointer to a smartable object
+
+	A borrowed pointer refers to an object that is owned elsewhere, typically
+	by its parent in a tree, and doesn't maintain the object reference count.
+	It is intended for short lived references (stacks of a tree walk, visit
+	arguments) that never outlive the owner of the object.
+\n	A SMARTP can be built from a borrowed pointer when ownership is required.
+*/
+template<class T> class borrowed {
+	private:
+		T* fPtr;
+
+	public:
+		borrowed() : fPtr(0) {}
+		borrowed(T* ptr) : fPtr(ptr) {}
+		template<class T2>
+		borrowed(const SMARTP<T2>& ptr) : fPtr((T2*)ptr) {}
+
+		operator T*() const		{ return fPtr; }
+		T& operator*() const	{ assert (fPtr != 0); return *fPtr; }
+		T* operator->() const	{ assert (fPtr != 0); return fPtr; }
+		//! gives an owning smart pointer to the object
+		SMARTP<T> own() const	{ return SMARTP<T>(fPtr); }
+
+		/*!
+		\brief a smart pointer reference to a borrowed object
+
+			Gives a borrowed object to the functions that take a SMARTP reference
+			(e.g. the visitors callbacks) without maintaining its reference count.
+			The copies made by the callee own the object as usual.
+		\warning the callee must not assign, move or reset the SMARTP reference:
+			it would release a reference that was never taken. This is asserted
+			when the ref is destroyed.
+		*/
+		class ref {
+			private:
+				SMARTP<T>	fPtr;
+				T*			fBorrowed;
+
+				ref(const ref&);
+				ref& operator= (const ref&);
+
+			public:
+				ref(T* ptr) : fPtr(ptr, typename SMARTP<T>::noreference()), fBorrowed(ptr) {}
+				~ref()	{ assert (fPtr.fSmartPtr == fBorrowed); fPtr.fSmartPtr = 0; }
+
+				operator SMARTP<T>& ()	{ return fPtr; }
+		};
 };
 
 }
@@ -13,6 +13,8 @@
 #ifndef __tree_browser__
 #define __tree_browser__
 
+#include <vector>
+
 #include "exports.h"
 #include "basevisitor.h"
 #include "browser.h"
@@ -46,6 +48,35 @@ template <typename T> class EXP tree_browser : public browser<T>
 		}
 };
 
+//______________________________________________________________________________
+/*!
+\brief a tree browser that drives several visitors in a single walk
+
+	Each visitor receives exactly the calls it would receive from its own
+	tree_browser: the visitors must not depend on each other.
+*/
+template <typename T> class EXP multi_tree_browser : public browser<T> 
+{
+	protected:
+		std::vector<basevisitor*>	fVisitors;
+
+		virtual void enter (T& t)		{ for (size_t i = 0; i < fVisitors.size(); i++) t.acceptIn(*fVisitors[i]); }
+		virtual void leave (T& t)		{ for (size_t i = 0; i < fVisitors.size(); i++) t.acceptOut(*fVisitors[i]); }
+
+	public:
+				 multi_tree_browser() {}
+		virtual ~multi_tree_browser() {}
+
+		virtual void add (basevisitor* v)	{ fVisitors.push_back(v); }
+		virtual void browse (T& t) {
+			enter(t);
+			typename ctree<T>::literator iter;
+			for (iter = t.lbegin(); iter != t.lend(); iter++)
+				browse(**iter);
+			leave(t);
+		}
+};
+
 }
 
 #endif
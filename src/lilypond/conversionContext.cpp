@@ -0,0 +1,88 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#include "conversionContext.h"
+
+#include "generalOptions.h"
+#include "traceOptions.h"
+#include "musicXMLOptions.h"
+#include "msrOptions.h"
+#include "lpsrOptions.h"
+#include "lilypondOptions.h"
+#include "extraOptions.h"
+#include "xml2lyOptionsHandling.h"
+
+
+using namespace std;
+
+namespace MusicXML2
+{
+
+// code taken from:
+// http://comp.lang.cpp.moderated.narkive.com/fylLGJgp/redirect-output-to-dev-null
+template<typename Ch, typename Traits = std::char_traits<Ch> >
+struct basic_nullbuf : std::basic_streambuf<Ch, Traits>
+{
+  typedef std::basic_streambuf<Ch, Traits> base_type;
+  typedef typename base_type::int_type int_type;
+  typedef typename base_type::traits_type traits_type;
+
+  virtual int_type overflow (int_type c) {
+    return traits_type::not_eof (c);
+  }
+};
+
+// convenient typedefs
+typedef basic_nullbuf <char>    nullbuf;
+
+// the null buffer has no state, it is shared by the contexts null streams
+static nullbuf cnull_obj;
+
+//______________________________________________________________________________
+conversionContext::conversionContext (
+  ostream& logStream,
+  ostream& outputStream)
+    : fNullStream (& cnull_obj),
+      fOutputIOstream (outputStream, fIndenter),
+      fLogIOstream (logStream, fIndenter),
+      fNullIOstream (fNullStream, fIndenter)
+{
+  fSegmentsCounter = 0;
+  fPartsCounter = 0;
+}
+
+conversionContext::~conversionContext ()
+{}
+
+//______________________________________________________________________________
+// the context set by the calling thread, if any
+static thread_local conversionContext* gCurrentContext = 0;
+
+conversionContext& conversionContext::current ()
+{
+  if (! gCurrentContext) {
+    // the default context of the calling thread
+    static thread_local conversionContext defaultContext;
+
+    gCurrentContext = &defaultContext;
+  }
+
+  return *gCurrentContext;
+}
+
+void conversionContext::setCurrent (conversionContext* context)
+{
+  gCurrentContext = context;
+}
+
+
+}
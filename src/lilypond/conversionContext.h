@@ -0,0 +1,165 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+#ifndef ___conversionContext___
+#define ___conversionContext___
+
+#include <iostream>
+#include <set>
+
+#include "exports.h"
+#include "smartpointer.h"
+
+#include "utilities.h"
+
+
+namespace MusicXML2
+{
+
+class generalOptions;
+class traceOptions;
+class musicXMLOptions;
+class msrOptions;
+class lpsrOptions;
+class lilypondOptions;
+class extraOptions;
+class xml2lyOptions;
+
+//______________________________________________________________________________
+class EXP conversionContext
+{
+/*
+  The state of a conversion: options, indentation, logging,
+  timing and diagnostics.
+
+  The g* shortcut macros (gIndenter, gLogIOstream, gMsrOptions, ...)
+  refer to the context that is current in the calling thread,
+  so that conversions run concurrently on different threads,
+  each one with its own context.
+
+  A default context, logging to std::cerr and writing to std::cout,
+  is used by threads that have not set a context of their own.
+
+Usage:
+  conversionContext context (logStream, outputStream);
+  conversionContext::setCurrent (&context);
+  ... create the options handler and run the passes
+  conversionContext::setCurrent (0);
+*/
+
+  public:
+
+    // constructors/destructor
+    // ------------------------------------------------------
+
+    conversionContext (
+      std::ostream& logStream    = std::cerr,
+      std::ostream& outputStream = std::cout);
+
+    virtual ~conversionContext ();
+
+  public:
+
+    // the current context of the calling thread
+    // ------------------------------------------------------
+
+    static conversionContext&
+                          current ();
+
+    // makes context the current context of the calling thread,
+    // null to go back to the default context
+    static void           setCurrent (conversionContext* context);
+
+  public:
+
+    // indentation and streams
+    // ------------------------------------------------------
+
+    indenter              fIndenter;
+
+    std::ostream          fNullStream;
+
+    indentedOstream       fOutputIOstream;
+    indentedOstream       fLogIOstream;
+    indentedOstream       fNullIOstream;
+
+    // timing
+    // ------------------------------------------------------
+
+    timing                fTiming;
+
+    // diagnostics
+    // ------------------------------------------------------
+
+    std::set<int>         fWarningsInputLineNumbers;
+    std::set<int>         fErrorsInputLineNumbers;
+
+    // options
+    // ------------------------------------------------------
+
+    SMARTP<generalOptions>
+                          fGeneralOptions;
+    SMARTP<generalOptions>
+                          fGeneralOptionsUserChoices;
+    SMARTP<generalOptions>
+                          fGeneralOptionsWithDetailedTrace;
+
+    SMARTP<traceOptions>  fTraceOptions;
+    SMARTP<traceOptions>  fTraceOptionsUserChoices;
+    SMARTP<traceOptions>  fTraceOptionsWithDetailedTrace;
+
+    SMARTP<musicXMLOptions>
+                          fMusicXMLOptions;
+    SMARTP<musicXMLOptions>
+                          fMusicXMLOptionsUserChoices;
+    SMARTP<musicXMLOptions>
+                          fMusicXMLOptionsWithDetailedTrace;
+
+    SMARTP<msrOptions>    fMsrOptions;
+    SMARTP<msrOptions>    fMsrOptionsUserChoices;
+    SMARTP<msrOptions>    fMsrOptionsWithDetailedTrace;
+
+    SMARTP<lpsrOptions>   fLpsrOptions;
+    SMARTP<lpsrOptions>   fLpsrOptionsUserChoices;
+    SMARTP<lpsrOptions>   fLpsrOptionsWithDetailedTrace;
+
+    SMARTP<lilypondOptions>
+                          fLilypondOptions;
+    SMARTP<lilypondOptions>
+                          fLilypondOptionsUserChoices;
+    SMARTP<lilypondOptions>
+                          fLilypondOptionsWithDetailedTrace;
+
+    SMARTP<extraOptions>  fExtraOptions;
+    SMARTP<extraOptions>  fExtraOptionsUserChoices;
+    SMARTP<extraOptions>  fExtraOptionsWithDetailedTrace;
+
+    SMARTP<xml2lyOptions> fXml2lyOptions;
+
+    // MSR elements numbering
+    // ------------------------------------------------------
+
+    int                   fSegmentsCounter;
+    int                   fPartsCounter;
+
+  private:
+
+    // contexts are not copyable
+    conversionContext (const conversionContext&);
+    conversionContext& operator= (const conversionContext&);
+};
+
+
+} // namespace MusicXML2
+
+
+#endif
@@ -346,9 +346,6 @@ ostream& operator<< (ostream& os, const S_optionsShowChordAnalysisItem& elt)
 
 //_______________________________________________________________________________
 
-S_extraOptions gExtraOptions;
-S_extraOptions gExtraOptionsUserChoices;
-S_extraOptions gExtraOptionsWithDetailedTrace;
 
 S_extraOptions extraOptions::create (
   S_optionsHandler optionsHandler)
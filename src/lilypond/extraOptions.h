@@ -368,9 +368,10 @@ class extraOptions : public optionsGroup
 typedef SMARTP<extraOptions> S_extraOptions;
 EXP ostream& operator<< (ostream& os, const S_extraOptions& elt);
 
-EXP extern S_extraOptions gExtraOptions;
-EXP extern S_extraOptions gExtraOptionsUserChoices;
-EXP extern S_extraOptions gExtraOptionsWithDetailedTrace;
+// the options of the current conversion context
+#define gExtraOptions                  (conversionContext::current ().fExtraOptions)
+#define gExtraOptionsUserChoices       (conversionContext::current ().fExtraOptionsUserChoices)
+#define gExtraOptionsWithDetailedTrace (conversionContext::current ().fExtraOptionsWithDetailedTrace)
 
 //______________________________________________________________________________
 void initializeExtraOptionsHandling (
@@ -23,9 +23,6 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-S_generalOptions gGeneralOptions;
-S_generalOptions gGeneralOptionsUserChoices;
-
 S_generalOptions generalOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -200,6 +197,10 @@ R"(Write information about CPU usage to standard error.)",
   {
     // variables  
   
+    fExit2a = false;
+    fExit2b = false;
+    fExit3  = false;
+    
     // options
   
     S_optionsSubGroup
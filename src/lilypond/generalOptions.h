@@ -111,9 +111,10 @@ class generalOptions : public optionsGroup
 typedef SMARTP<generalOptions> S_generalOptions;
 EXP ostream& operator<< (ostream& os, const S_generalOptions& elt);
 
-EXP extern S_generalOptions gGeneralOptions;
-EXP extern S_generalOptions gGeneralOptionsUserChoices;
-EXP extern S_generalOptions gGeneralOptionsWithDetailedTrace;
+// the options of the current conversion context
+#define gGeneralOptions                  (conversionContext::current ().fGeneralOptions)
+#define gGeneralOptionsUserChoices       (conversionContext::current ().fGeneralOptionsUserChoices)
+#define gGeneralOptionsWithDetailedTrace (conversionContext::current ().fGeneralOptionsWithDetailedTrace)
 
 //______________________________________________________________________________
 void initializeGeneralOptionsHandling (
@@ -212,10 +212,6 @@ ostream& operator<< (ostream& os, const S_optionsMidiTempoItem& elt)
 }
 
 //_______________________________________________________________________________
-S_lilypondOptions gLilypondOptions;
-S_lilypondOptions gLilypondOptionsUserChoices;
-S_lilypondOptions gLilypondOptionsWithDetailedTrace;
-
 S_lilypondOptions lilypondOptions::create (
   S_optionsHandler optionsHandler)
 {
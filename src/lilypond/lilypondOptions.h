@@ -478,9 +478,10 @@ pickCopyright
 typedef SMARTP<lilypondOptions> S_lilypondOptions;
 EXP ostream& operator<< (ostream& os, const S_lilypondOptions& elt);
 
-EXP extern S_lilypondOptions gLilypondOptions;
-EXP extern S_lilypondOptions gLilypondOptionsUserChoices;
-EXP extern S_lilypondOptions gLilypondOptionsWithDetailedTrace;
+// the options of the current conversion context
+#define gLilypondOptions                  (conversionContext::current ().fLilypondOptions)
+#define gLilypondOptionsUserChoices       (conversionContext::current ().fLilypondOptionsUserChoices)
+#define gLilypondOptionsWithDetailedTrace (conversionContext::current ().fLilypondOptionsWithDetailedTrace)
 
 //______________________________________________________________________________
 void initializeLilypondOptionsHandling (
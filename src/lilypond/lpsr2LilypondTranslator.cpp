@@ -9034,13 +9034,13 @@ void lpsr2LilypondTranslator::generateGraceNotesGroup (
   // at the beginning of the grace notes
   fLastMetWholeNotes = rational (0, 1);
 
-  list<S_msrElement>&
+  vector<S_msrElement>&
     graceNotesGroupElementsList =
       graceNotesGroup->
         getGraceNotesGroupElementsList ();
 
   if (graceNotesGroupElementsList.size ()) {
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = graceNotesGroupElementsList.begin (),
       iEnd   = graceNotesGroupElementsList.end (),
       i      = iBegin;
@@ -815,7 +815,7 @@ string existingLpsrChordsLanguageKinds ()
 }
 
 //______________________________________________________________________________
-void initializeLPSRBasicTypes ()
+static void buildLPSRBasicTypes ()
 {
   // LPSR accidental styles handling
   // ------------------------------------------------------
@@ -828,5 +828,16 @@ void initializeLPSRBasicTypes ()
   initializeLpsrChordsLanguageKindsMap ();
 }
 
+void initializeLPSRBasicTypes ()
+{
+  // the maps are read by concurrent conversions,
+  // they're built once for all threads
+  static const bool
+    lpsrBasicTypesInitialized =
+      (buildLPSRBasicTypes (), true);
+
+  (void) lpsrBasicTypesInitialized;
+}
+
 
 }
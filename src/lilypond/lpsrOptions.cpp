@@ -208,10 +208,6 @@ ostream& operator<< (ostream& os, const S_optionsLpsrChordsLanguageItem& elt)
 }
 
 //_______________________________________________________________________________
-S_lpsrOptions gLpsrOptions;
-S_lpsrOptions gLpsrOptionsUserChoices;
-S_lpsrOptions gLpsrOptionsWithDetailedTrace;
-
 S_lpsrOptions lpsrOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -371,6 +367,9 @@ This may come in handy when MusicXML data has been obtained from scanned images.
       optionError (s.str ());
     }
   
+    fLpsrChordsLanguageKind =
+      k_IgnatzekChords; // LilyPond default
+    
     // options
     
     S_optionsSubGroup
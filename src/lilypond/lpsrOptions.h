@@ -267,9 +267,10 @@ class lpsrOptions : public optionsGroup
 typedef SMARTP<lpsrOptions> S_lpsrOptions;
 EXP ostream& operator<< (ostream& os, const S_lpsrOptions& elt);
 
-EXP extern S_lpsrOptions gLpsrOptions;
-EXP extern S_lpsrOptions gLpsrOptionsUserChoices;
-EXP extern S_lpsrOptions gLpsrOptionsWithDetailedTrace;
+// the options of the current conversion context
+#define gLpsrOptions                  (conversionContext::current ().fLpsrOptions)
+#define gLpsrOptionsUserChoices       (conversionContext::current ().fLpsrOptionsUserChoices)
+#define gLpsrOptionsWithDetailedTrace (conversionContext::current ().fLpsrOptionsWithDetailedTrace)
 
 //______________________________________________________________________________
 EXP  void initializeLpsrOptionsHandling (
@@ -371,10 +371,28 @@ lpsrScore::lpsrScore (
       "Comment or adapt next line as needed (default is 20)",
       lpsrSchemeVariable::kWithEndlTwice);
 
+  // initialize files includes informations
+  fJianpuFileIncludeIsNeeded = false;
+
+  // initialize Scheme modules informations
+  fScmAndAccregSchemeModulesAreNeeded = false;
+
   // initialize Scheme functions informations
-  fTongueSchemeFunctionIsNeeded              = false;
-  fCustomShortBarLineSchemeFunctionIsNeeded  = false;
-  fEditorialAccidentalSchemeFunctionIsNeeded = false;
+  fTongueSchemeFunctionIsNeeded                = false;
+  fCustomShortBarLineSchemeFunctionIsNeeded    = false;
+  fEditorialAccidentalSchemeFunctionIsNeeded   = false;
+  fDynamicsSchemeFunctionIsNeeded              = false;
+  fTupletsCurvedBracketsSchemeFunctionIsNeeded = false;
+  fAfterSchemeFunctionIsNeeded                 = false;
+  fTempoRelationshipSchemeFunctionIsNeeded     = false;
+  fGlissandoWithTextSchemeFunctionIsNeeded     = false;
+
+  // initialize markups informations
+  fDampMarkupIsNeeded    = false;
+  fDampAllMarkupIsNeeded = false;
+
+  // initialize white note heads informations
+  fWhiteNoteHeadsIsNeeded = false;
 
   if (gLilypondOptions->fLilypondCompileDate) {
     // create the date and time functions
@@ -257,9 +257,6 @@ void msrStreamsWarning (
 }
 
 //______________________________________________________________________________
-std::set<int> gWarningsInputLineNumbers;
-std::set<int> gErrorsInputLineNumbers;
-
 void displayWarningsAndErrorsInputLineNumbers ()
 {
   int warningsInputLineNumbersSize =
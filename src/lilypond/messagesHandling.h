@@ -18,6 +18,8 @@
 
 #include "exports.h"
 
+#include "conversionContext.h"
+
 
 namespace MusicXML2 
 {
@@ -107,8 +109,9 @@ EXP void msrStreamsWarning (
   std::string message);
 
 //______________________________________________________________________________
-EXP extern std::set<int> gWarningsInputLineNumbers;
-EXP extern std::set<int> gErrorsInputLineNumbers;
+// the diagnostics of the current conversion context
+#define gWarningsInputLineNumbers (conversionContext::current ().fWarningsInputLineNumbers)
+#define gErrorsInputLineNumbers   (conversionContext::current ().fErrorsInputLineNumbers)
 
 EXP void displayWarningsAndErrorsInputLineNumbers ();
 
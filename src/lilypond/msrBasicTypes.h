@@ -1103,6 +1103,7 @@ string msrScoreNotationKindAsString (
 //______________________________________________________________________________
 // global variables
 
+// built on first use by printChordStructuresMap ()
 extern map<msrHarmonyKind, S_msrChordStructure>
   gChordStructuresMap;
 
@@ -1113,6 +1114,8 @@ void printChordStructuresMap ();
 extern map<string, msrQuarterTonesPitchesLanguageKind>
   gQuarterTonesPitchesLanguageKindsMap;
 
+// built on first use by msrQuarterTonesPitchKindAsString ()
+// and msrQuarterTonesPitchKindFromString ()
 extern map<msrQuarterTonesPitchKind, string> gNederlandsPitchNamesMap;
 extern map<msrQuarterTonesPitchKind, string> gCatalanPitchNamesMap;
 extern map<msrQuarterTonesPitchKind, string> gDeutschPitchNamesMap;
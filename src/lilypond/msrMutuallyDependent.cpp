@@ -1263,7 +1263,7 @@ S_msrGraceNotesGroup msrGraceNotesGroup::createSkipGraceNotesGroupClone (
     
   // populating the clone with skips
   for (
-    list<S_msrElement>::const_iterator i=fGraceNotesGroupElementsList.begin ();
+    vector<S_msrElement>::const_iterator i=fGraceNotesGroupElementsList.begin ();
     i!=fGraceNotesGroupElementsList.end ();
     i++) {      
     if (
@@ -1479,7 +1479,7 @@ void msrGraceNotesGroup::acceptOut (basevisitor* v)
 
 void msrGraceNotesGroup::browseData (basevisitor* v)
 {
-  list<S_msrElement>::const_iterator i;
+  vector<S_msrElement>::const_iterator i;
 
   for (
     i=fGraceNotesGroupElementsList.begin ();
@@ -1504,7 +1504,7 @@ string msrGraceNotesGroup::asShortString () const
     "\", line " << fInputLineNumber << " ";
 
   if (fGraceNotesGroupElementsList.size ()) {
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = fGraceNotesGroupElementsList.begin (),
       iEnd   = fGraceNotesGroupElementsList.end (),
       i      = iBegin;
@@ -1529,7 +1529,7 @@ string msrGraceNotesGroup::asString () const
     "\", line " << fInputLineNumber << " ";
 
   if (fGraceNotesGroupElementsList.size ()) {
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = fGraceNotesGroupElementsList.begin (),
       iEnd   = fGraceNotesGroupElementsList.end (),
       i      = iBegin;
@@ -1620,7 +1620,7 @@ void msrGraceNotesGroup::print (ostream& os)
       
     gIndenter++;
   
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = fGraceNotesGroupElementsList.begin (),
       iEnd   = fGraceNotesGroupElementsList.end (),
       i      = iBegin;
@@ -2416,6 +2416,25 @@ void msrNote::initializeNote ()
 msrNote::~msrNote ()
 {}
 
+const msrNoteAttachments& msrNote::getNoteAttachments () const
+{
+  static const msrNoteAttachments noAttachments;
+
+  return
+    fNoteAttachments
+      ? *fNoteAttachments
+      : noAttachments;
+}
+
+msrNoteAttachments& msrNote::getNoteAttachmentsToModify ()
+{
+  if (! fNoteAttachments) {
+    fNoteAttachments.reset (new msrNoteAttachments);
+  }
+  
+  return *fNoteAttachments;
+}
+
 void msrNote::setNoteKind (msrNoteKind noteKind)
 {
 #ifdef TRACE_OPTIONS
@@ -2842,10 +2861,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 /* JMI
   {
     list<S_msrSyllable>::const_iterator i;
-    for (i=fNoteSyllables.begin (); i!=fNoteSyllables.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSyllables.begin (); i!=getNoteAttachments ().fNoteSyllables.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteSyllables.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteSyllables.push_back ((*i));
     } // for
   }
 */
@@ -2862,10 +2881,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrBeam>::const_iterator i;
-    for (i=fNoteBeams.begin (); i!=fNoteBeams.end (); i++) {
+    for (i=getNoteAttachments ().fNoteBeams.begin (); i!=getNoteAttachments ().fNoteBeams.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteBeams.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteBeams.push_back ((*i));
     } // for
   }
   
@@ -2874,12 +2893,12 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   for (
     list<S_msrArticulation>::const_iterator i=
-      fNoteArticulations.begin ();
-      i!=fNoteArticulations.end ();
+      getNoteAttachments ().fNoteArticulations.begin ();
+      i!=getNoteAttachments ().fNoteArticulations.end ();
       i++) {
     // share this data
     noteDeepCopy->
-      fNoteArticulations.push_back ((*i));
+      getNoteAttachmentsToModify ().fNoteArticulations.push_back ((*i));
   } // for
 
   // spanners
@@ -2887,12 +2906,12 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   for (
     list<S_msrSpanner>::const_iterator i=
-      fNoteSpanners.begin ();
-      i!=fNoteSpanners.end ();
+      getNoteAttachments ().fNoteSpanners.begin ();
+      i!=getNoteAttachments ().fNoteSpanners.end ();
       i++) {
     // share this data
     noteDeepCopy->
-      fNoteSpanners.push_back ((*i));
+      getNoteAttachmentsToModify ().fNoteSpanners.push_back ((*i));
   } // for
 
   // technicals
@@ -2901,36 +2920,36 @@ S_msrNote msrNote::createNoteDeepCopy (
   {
     list<S_msrTechnical>::const_iterator i;
     for (
-      i=fNoteTechnicals.begin ();
-      i!=fNoteTechnicals.end ();
+      i=getNoteAttachments ().fNoteTechnicals.begin ();
+      i!=getNoteAttachments ().fNoteTechnicals.end ();
       i++) {
       // share this data
       noteDeepCopy->
-        fNoteTechnicals.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteTechnicals.push_back ((*i));
     } // for
   }
   
   {
     list<S_msrTechnicalWithInteger>::const_iterator i;
     for (
-      i=fNoteTechnicalWithIntegers.begin ();
-      i!=fNoteTechnicalWithIntegers.end ();
+      i=getNoteAttachments ().fNoteTechnicalWithIntegers.begin ();
+      i!=getNoteAttachments ().fNoteTechnicalWithIntegers.end ();
       i++) {
       // share this data
       noteDeepCopy->
-        fNoteTechnicalWithIntegers.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteTechnicalWithIntegers.push_back ((*i));
     } // for
   }
   
   {
     list<S_msrTechnicalWithString>::const_iterator i;
     for (
-      i=fNoteTechnicalWithStrings.begin ();
-      i!=fNoteTechnicalWithStrings.end ();
+      i=getNoteAttachments ().fNoteTechnicalWithStrings.begin ();
+      i!=getNoteAttachments ().fNoteTechnicalWithStrings.end ();
       i++) {
       // share this data
       noteDeepCopy->
-        fNoteTechnicalWithStrings.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteTechnicalWithStrings.push_back ((*i));
     } // for
   }
   
@@ -2939,10 +2958,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrOrnament>::const_iterator i;
-    for (i=fNoteOrnaments.begin (); i!=fNoteOrnaments.end (); i++) {
+    for (i=getNoteAttachments ().fNoteOrnaments.begin (); i!=getNoteAttachments ().fNoteOrnaments.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteOrnaments.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteOrnaments.push_back ((*i));
     } // for
   }
   
@@ -2951,10 +2970,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrGlissando>::const_iterator i;
-    for (i=fNoteGlissandos.begin (); i!=fNoteGlissandos.end (); i++) {
+    for (i=getNoteAttachments ().fNoteGlissandos.begin (); i!=getNoteAttachments ().fNoteGlissandos.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteGlissandos.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteGlissandos.push_back ((*i));
     } // for
   }
   
@@ -2963,10 +2982,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrSlide>::const_iterator i;
-    for (i=fNoteSlides.begin (); i!=fNoteSlides.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSlides.begin (); i!=getNoteAttachments ().fNoteSlides.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteSlides.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteSlides.push_back ((*i));
     } // for
   }
   
@@ -3004,19 +3023,19 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrDynamics>::const_iterator i;
-    for (i=fNoteDynamics.begin (); i!=fNoteDynamics.end (); i++) {
+    for (i=getNoteAttachments ().fNoteDynamics.begin (); i!=getNoteAttachments ().fNoteDynamics.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteDynamics.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteDynamics.push_back ((*i));
     } // for
   }
 
   {
     list<S_msrOtherDynamics>::const_iterator i;
-    for (i=fNoteOtherDynamics.begin (); i!=fNoteOtherDynamics.end (); i++) {
+    for (i=getNoteAttachments ().fNoteOtherDynamics.begin (); i!=getNoteAttachments ().fNoteOtherDynamics.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteOtherDynamics.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteOtherDynamics.push_back ((*i));
     } // for
   }
   
@@ -3025,10 +3044,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrSlash>::const_iterator i;
-    for (i=fNoteSlashes.begin (); i!=fNoteSlashes.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSlashes.begin (); i!=getNoteAttachments ().fNoteSlashes.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteSlashes.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteSlashes.push_back ((*i));
     } // for
   }
   
@@ -3037,10 +3056,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrWedge>::const_iterator i;
-    for (i=fNoteWedges.begin (); i!=fNoteWedges.end (); i++) {
+    for (i=getNoteAttachments ().fNoteWedges.begin (); i!=getNoteAttachments ().fNoteWedges.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteWedges.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteWedges.push_back ((*i));
     } // for
   }
   
@@ -3049,10 +3068,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrEyeGlasses>::const_iterator i;
-    for (i=fNoteEyeGlasses.begin (); i!=fNoteEyeGlasses.end (); i++) {
+    for (i=getNoteAttachments ().fNoteEyeGlasses.begin (); i!=getNoteAttachments ().fNoteEyeGlasses.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteEyeGlasses.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteEyeGlasses.push_back ((*i));
     } // for
   }
   
@@ -3061,10 +3080,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrDamp>::const_iterator i;
-    for (i=fNoteDamps.begin (); i!=fNoteDamps.end (); i++) {
+    for (i=getNoteAttachments ().fNoteDamps.begin (); i!=getNoteAttachments ().fNoteDamps.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteDamps.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteDamps.push_back ((*i));
     } // for
   }
   
@@ -3073,10 +3092,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrDampAll>::const_iterator i;
-    for (i=fNoteDampAlls.begin (); i!=fNoteDampAlls.end (); i++) {
+    for (i=getNoteAttachments ().fNoteDampAlls.begin (); i!=getNoteAttachments ().fNoteDampAlls.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteDampAlls.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteDampAlls.push_back ((*i));
     } // for
   }
   
@@ -3085,10 +3104,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrScordatura>::const_iterator i;
-    for (i=fNoteScordaturas.begin (); i!=fNoteScordaturas.end (); i++) {
+    for (i=getNoteAttachments ().fNoteScordaturas.begin (); i!=getNoteAttachments ().fNoteScordaturas.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteScordaturas.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteScordaturas.push_back ((*i));
     } // for
   }
   
@@ -3097,10 +3116,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrWords>::const_iterator i;
-    for (i=fNoteWords.begin (); i!=fNoteWords.end (); i++) {
+    for (i=getNoteAttachments ().fNoteWords.begin (); i!=getNoteAttachments ().fNoteWords.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteWords.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteWords.push_back ((*i));
     } // for
   }
   
@@ -3109,10 +3128,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   {
     list<S_msrSlur>::const_iterator i;
-    for (i=fNoteSlurs.begin (); i!=fNoteSlurs.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSlurs.begin (); i!=getNoteAttachments ().fNoteSlurs.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteSlurs.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteSlurs.push_back ((*i));
     } // for
   }
   
@@ -3121,10 +3140,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   { 
     list<S_msrLigature>::const_iterator i;
-    for (i=fNoteLigatures.begin (); i!=fNoteLigatures.end (); i++) {
+    for (i=getNoteAttachments ().fNoteLigatures.begin (); i!=getNoteAttachments ().fNoteLigatures.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNoteLigatures.push_back ((*i));
+        getNoteAttachmentsToModify ().fNoteLigatures.push_back ((*i));
     } // for
   }
   
@@ -3133,10 +3152,10 @@ S_msrNote msrNote::createNoteDeepCopy (
 
   { 
     list<S_msrPedal>::const_iterator i;
-    for (i=fNotePedals.begin (); i!=fNotePedals.end (); i++) {
+    for (i=getNoteAttachments ().fNotePedals.begin (); i!=getNoteAttachments ().fNotePedals.end (); i++) {
       // share this data
       noteDeepCopy->
-        fNotePedals.push_back ((*i));
+        getNoteAttachmentsToModify ().fNotePedals.push_back ((*i));
     } // for
   }
 
@@ -3867,7 +3886,7 @@ void msrNote::appendBeamToNote (S_msrBeam beam)
   }
 #endif
 
-  fNoteBeams.push_back (beam);
+  getNoteAttachmentsToModify ().fNoteBeams.push_back (beam);
 }
 
 void msrNote::appendArticulationToNote (S_msrArticulation art)
@@ -3884,7 +3903,7 @@ void msrNote::appendArticulationToNote (S_msrArticulation art)
   }
 #endif
 
-  fNoteArticulations.push_back (art);
+  getNoteAttachmentsToModify ().fNoteArticulations.push_back (art);
 }
 
 void msrNote::appendSpannerToNote (S_msrSpanner spanner)
@@ -3924,7 +3943,7 @@ void msrNote::appendSpannerToNote (S_msrSpanner spanner)
   } // switch
 
   // append spanner to note spanners
-  fNoteSpanners.push_back (spanner);
+  getNoteAttachmentsToModify ().fNoteSpanners.push_back (spanner);
 }
 
 void msrNote::appendTechnicalToNote (S_msrTechnical technical)
@@ -3941,7 +3960,7 @@ void msrNote::appendTechnicalToNote (S_msrTechnical technical)
 #endif
   
   // append the technical to the note technicals list
-  fNoteTechnicals.push_back (technical);
+  getNoteAttachmentsToModify ().fNoteTechnicals.push_back (technical);
 }
 
 void msrNote::appendTechnicalWithIntegerToNote (
@@ -3959,7 +3978,7 @@ void msrNote::appendTechnicalWithIntegerToNote (
 #endif
 
   // append the technical with integer to the note technicals with integers list
-  fNoteTechnicalWithIntegers.push_back (
+  getNoteAttachmentsToModify ().fNoteTechnicalWithIntegers.push_back (
     technicalWithInteger);
 }
 
@@ -3978,7 +3997,7 @@ void msrNote::appendTechnicalWithFloatToNote (
 #endif
 
   // append the technical with float to the note technicals with floats list
-  fNoteTechnicalWithFloats.push_back (
+  getNoteAttachmentsToModify ().fNoteTechnicalWithFloats.push_back (
     technicalWithFloat);
 }
 
@@ -3997,7 +4016,7 @@ void msrNote::appendTechnicalWithStringToNote (
 #endif
 
   // append the technical with string to the note technicals with strings list
-  fNoteTechnicalWithStrings.push_back (
+  getNoteAttachmentsToModify ().fNoteTechnicalWithStrings.push_back (
     technicalWithString);
 }
 
@@ -4016,7 +4035,7 @@ void msrNote::appendOrnamentToNote (S_msrOrnament ornament)
 #endif
 
   // append the ornament to the note ornaments list
-  fNoteOrnaments.push_back (ornament);
+  getNoteAttachmentsToModify ().fNoteOrnaments.push_back (ornament);
 
   switch (ornament->getOrnamentKind ()) {
     case msrOrnament::kOrnamentTrill:
@@ -4059,7 +4078,7 @@ void msrNote::appendGlissandoToNote (S_msrGlissando glissando)
 #endif
 
   // append the glissando to the note glissandos list
-  fNoteGlissandos.push_back (glissando);
+  getNoteAttachmentsToModify ().fNoteGlissandos.push_back (glissando);
 }
 
 void msrNote::appendSlideToNote (S_msrSlide slide)
@@ -4077,7 +4096,7 @@ void msrNote::appendSlideToNote (S_msrSlide slide)
 #endif
 
   // append the slide to the note glissandos list
-  fNoteSlides.push_back (slide);
+  getNoteAttachmentsToModify ().fNoteSlides.push_back (slide);
 }
 
 void msrNote::setNoteGraceNotesGroupBefore (
@@ -4176,16 +4195,16 @@ void msrNote::appendDynamicsToNote (S_msrDynamics dynamics)
   }
 #endif
 
-  fNoteDynamics.push_back (dynamics);
+  getNoteAttachmentsToModify ().fNoteDynamics.push_back (dynamics);
 }
 void msrNote::appendOtherDynamicsToNote (S_msrOtherDynamics otherDynamics)
 {
-  fNoteOtherDynamics.push_back (otherDynamics);
+  getNoteAttachmentsToModify ().fNoteOtherDynamics.push_back (otherDynamics);
 }
 
 void msrNote::appendWordsToNote (S_msrWords words)
 {
-  fNoteWords.push_back (words);
+  getNoteAttachmentsToModify ().fNoteWords.push_back (words);
 }
 
 void msrNote::appendSlurToNote (S_msrSlur slur)
@@ -4199,7 +4218,7 @@ void msrNote::appendSlurToNote (S_msrSlur slur)
   }
 #endif
 
-  fNoteSlurs.push_back (slur);
+  getNoteAttachmentsToModify ().fNoteSlurs.push_back (slur);
 }
 
 void msrNote::appendLigatureToNote (S_msrLigature ligature)
@@ -4212,13 +4231,13 @@ void msrNote::appendLigatureToNote (S_msrLigature ligature)
   }
 #endif
 
-  if (fNoteLigatures.size ()) {
+  if (getNoteAttachments ().fNoteLigatures.size ()) {
     if (
-      fNoteLigatures.back ()->getLigatureKind () == msrLigature::kLigatureStart
+      getNoteAttachments ().fNoteLigatures.back ()->getLigatureKind () == msrLigature::kLigatureStart
         &&
       ligature->getLigatureKind () == msrLigature::kLigatureStop
         &&
-      fNoteLigatures.back ()->getLigatureNumber () == ligature->getLigatureNumber ()
+      getNoteAttachments ().fNoteLigatures.back ()->getLigatureNumber () == ligature->getLigatureNumber ()
       ) {
       // it may happen that a given note has a 'ligature start'
       // and a 'ligature stop' in sequence, ignore both
@@ -4247,17 +4266,17 @@ void msrNote::appendLigatureToNote (S_msrLigature ligature)
       }
 #endif
 
-      fNoteLigatures.pop_back ();
+      getNoteAttachmentsToModify ().fNoteLigatures.pop_back ();
 
       // don't register 'ligature stop'
     }
 
     else
-      fNoteLigatures.push_back (ligature);
+      getNoteAttachmentsToModify ().fNoteLigatures.push_back (ligature);
   }
 
   else
-    fNoteLigatures.push_back (ligature);
+    getNoteAttachmentsToModify ().fNoteLigatures.push_back (ligature);
 }
 
 void msrNote::appendPedalToNote (S_msrPedal pedal)
@@ -4270,9 +4289,9 @@ void msrNote::appendPedalToNote (S_msrPedal pedal)
   }
 #endif
 
-  if (fNotePedals.size ()) {
+  if (getNoteAttachments ().fNotePedals.size ()) {
     if (
-      fNotePedals.back ()->getPedalTypeKind () == msrPedal::kPedalStart
+      getNoteAttachments ().fNotePedals.back ()->getPedalTypeKind () == msrPedal::kPedalStart
         &&
       pedal->getPedalTypeKind () == msrPedal::kPedalStop
       ) {
@@ -4302,17 +4321,17 @@ void msrNote::appendPedalToNote (S_msrPedal pedal)
           endl;
       }
 #endif
-      fNotePedals.pop_back ();
+      getNoteAttachmentsToModify ().fNotePedals.pop_back ();
 
       // don't register 'pedal stop'
     }
 
     else
-      fNotePedals.push_back (pedal);
+      getNoteAttachmentsToModify ().fNotePedals.push_back (pedal);
   }
 
   else
-    fNotePedals.push_back (pedal);
+    getNoteAttachmentsToModify ().fNotePedals.push_back (pedal);
 }
 
 void msrNote::appendSlashToNote (S_msrSlash slash)
@@ -4329,32 +4348,32 @@ void msrNote::appendSlashToNote (S_msrSlash slash)
   }
 #endif
 
-  fNoteSlashes.push_back (slash);
+  getNoteAttachmentsToModify ().fNoteSlashes.push_back (slash);
 }
 
 void msrNote::appendWedgeToNote (S_msrWedge wedge)
 {
-  fNoteWedges.push_back (wedge);
+  getNoteAttachmentsToModify ().fNoteWedges.push_back (wedge);
 }
 
 void msrNote::appendEyeGlassesToNote (S_msrEyeGlasses eyeGlasses)
 {
-  fNoteEyeGlasses.push_back (eyeGlasses);
+  getNoteAttachmentsToModify ().fNoteEyeGlasses.push_back (eyeGlasses);
 }
 
 void msrNote::appendDampToNote (S_msrDamp damp)
 {
-  fNoteDamps.push_back (damp);
+  getNoteAttachmentsToModify ().fNoteDamps.push_back (damp);
 }
 
 void msrNote::appendDampAllToNote (S_msrDampAll dampAll)
 {
-  fNoteDampAlls.push_back (dampAll);
+  getNoteAttachmentsToModify ().fNoteDampAlls.push_back (dampAll);
 }
 
 void msrNote::appendScordaturaToNote (S_msrScordatura scordatura)
 {
-  fNoteScordaturas.push_back (scordatura);
+  getNoteAttachmentsToModify ().fNoteScordaturas.push_back (scordatura);
 }
 
 S_msrDynamics msrNote::removeFirstDynamics () // JMI
@@ -4371,11 +4390,11 @@ S_msrDynamics msrNote::removeFirstDynamics () // JMI
 
   // sanity check
   msrAssert (
-    fNoteDynamics.size () > 0,
-    "fNoteDynamics is empty");
+    getNoteAttachments ().fNoteDynamics.size () > 0,
+    "getNoteAttachments ().fNoteDynamics is empty");
 
-  S_msrDynamics dyn = fNoteDynamics.front ();
-  fNoteDynamics.pop_front ();
+  S_msrDynamics dyn = getNoteAttachments ().fNoteDynamics.front ();
+  getNoteAttachmentsToModify ().fNoteDynamics.pop_front ();
   
   return dyn;
 }
@@ -4393,11 +4412,11 @@ S_msrWedge msrNote::removeFirstWedge () // JMI
 
   // sanity check
   msrAssert (
-    fNoteDynamics.size () > 0,
-    "fNoteDynamics is empty");
+    getNoteAttachments ().fNoteDynamics.size () > 0,
+    "getNoteAttachments ().fNoteDynamics is empty");
 
-  S_msrWedge wedge = fNoteWedges.front ();
-  fNoteWedges.pop_front ();
+  S_msrWedge wedge = getNoteAttachments ().fNoteWedges.front ();
+  getNoteAttachmentsToModify ().fNoteWedges.pop_front ();
   return wedge;
 }
 
@@ -4414,7 +4433,7 @@ void msrNote::appendSyllableToNote (S_msrSyllable syllable)
   }
 #endif
   
-  fNoteSyllables.push_back (syllable);
+  getNoteAttachmentsToModify ().fNoteSyllables.push_back (syllable);
 }
 
 void msrNote::setNoteHarmony (S_msrHarmony harmony)
@@ -4523,10 +4542,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the beams if any
-  if (fNoteBeams.size ()) {
+  if (getNoteAttachments ().fNoteBeams.size ()) {
     gIndenter++;
     list<S_msrBeam>::const_iterator i;
-    for (i=fNoteBeams.begin (); i!=fNoteBeams.end (); i++) {
+    for (i=getNoteAttachments ().fNoteBeams.begin (); i!=getNoteAttachments ().fNoteBeams.end (); i++) {
       // browse the beam
       msrBrowser<msrBeam> browser (v);
       browser.browse (*(*i));
@@ -4535,10 +4554,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the articulations if any
-  if (fNoteArticulations.size ()) {
+  if (getNoteAttachments ().fNoteArticulations.size ()) {
     gIndenter++;
     list<S_msrArticulation>::const_iterator i;
-    for (i=fNoteArticulations.begin (); i!=fNoteArticulations.end (); i++) {
+    for (i=getNoteAttachments ().fNoteArticulations.begin (); i!=getNoteAttachments ().fNoteArticulations.end (); i++) {
       // browse the articulation
       msrBrowser<msrArticulation> browser (v);
       browser.browse (*(*i));
@@ -4547,10 +4566,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the spanners if any
-  if (fNoteSpanners.size ()) {
+  if (getNoteAttachments ().fNoteSpanners.size ()) {
     gIndenter++;
     list<S_msrSpanner>::const_iterator i;
-    for (i=fNoteSpanners.begin (); i!=fNoteSpanners.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSpanners.begin (); i!=getNoteAttachments ().fNoteSpanners.end (); i++) {
       // browse the spanner
       msrBrowser<msrSpanner> browser (v);
       browser.browse (*(*i));
@@ -4559,12 +4578,12 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the technicals if any
-  if (fNoteTechnicals.size ()) {
+  if (getNoteAttachments ().fNoteTechnicals.size ()) {
     gIndenter++;
     list<S_msrTechnical>::const_iterator i;
     for (
-      i=fNoteTechnicals.begin ();
-      i!=fNoteTechnicals.end ();
+      i=getNoteAttachments ().fNoteTechnicals.begin ();
+      i!=getNoteAttachments ().fNoteTechnicals.end ();
       i++) {
       // browse the technical
       msrBrowser<msrTechnical> browser (v);
@@ -4574,12 +4593,12 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the technicals with integer if any
-  if (fNoteTechnicalWithIntegers.size ()) {
+  if (getNoteAttachments ().fNoteTechnicalWithIntegers.size ()) {
     gIndenter++;
     list<S_msrTechnicalWithInteger>::const_iterator i;
     for (
-      i=fNoteTechnicalWithIntegers.begin ();
-      i!=fNoteTechnicalWithIntegers.end ();
+      i=getNoteAttachments ().fNoteTechnicalWithIntegers.begin ();
+      i!=getNoteAttachments ().fNoteTechnicalWithIntegers.end ();
       i++) {
       // browse the technical
       msrBrowser<msrTechnicalWithInteger> browser (v);
@@ -4589,12 +4608,12 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the technicals with float if any
-  if (fNoteTechnicalWithFloats.size ()) {
+  if (getNoteAttachments ().fNoteTechnicalWithFloats.size ()) {
     gIndenter++;
     list<S_msrTechnicalWithFloat>::const_iterator i;
     for (
-      i=fNoteTechnicalWithFloats.begin ();
-      i!=fNoteTechnicalWithFloats.end ();
+      i=getNoteAttachments ().fNoteTechnicalWithFloats.begin ();
+      i!=getNoteAttachments ().fNoteTechnicalWithFloats.end ();
       i++) {
       // browse the technical
       msrBrowser<msrTechnicalWithFloat> browser (v);
@@ -4604,12 +4623,12 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the technicals with string if any
-  if (fNoteTechnicalWithStrings.size ()) {
+  if (getNoteAttachments ().fNoteTechnicalWithStrings.size ()) {
     gIndenter++;
     list<S_msrTechnicalWithString>::const_iterator i;
     for (
-      i=fNoteTechnicalWithStrings.begin ();
-      i!=fNoteTechnicalWithStrings.end ();
+      i=getNoteAttachments ().fNoteTechnicalWithStrings.begin ();
+      i!=getNoteAttachments ().fNoteTechnicalWithStrings.end ();
       i++) {
       // browse the technical
       msrBrowser<msrTechnicalWithString> browser (v);
@@ -4619,10 +4638,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the ornaments if any
-  if (fNoteOrnaments.size ()) {
+  if (getNoteAttachments ().fNoteOrnaments.size ()) {
     gIndenter++;
     list<S_msrOrnament>::const_iterator i;
-    for (i=fNoteOrnaments.begin (); i!=fNoteOrnaments.end (); i++) {
+    for (i=getNoteAttachments ().fNoteOrnaments.begin (); i!=getNoteAttachments ().fNoteOrnaments.end (); i++) {
       // browse the ornament
       msrBrowser<msrOrnament> browser (v);
       browser.browse (*(*i));
@@ -4631,10 +4650,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the glissandos if any
-  if (fNoteGlissandos.size ()) {
+  if (getNoteAttachments ().fNoteGlissandos.size ()) {
     gIndenter++;
     list<S_msrGlissando>::const_iterator i;
-    for (i=fNoteGlissandos.begin (); i!=fNoteGlissandos.end (); i++) {
+    for (i=getNoteAttachments ().fNoteGlissandos.begin (); i!=getNoteAttachments ().fNoteGlissandos.end (); i++) {
       // browse the glissando
       msrBrowser<msrGlissando> browser (v);
       browser.browse (*(*i));
@@ -4643,10 +4662,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the slides if any
-  if (fNoteSlides.size ()) {
+  if (getNoteAttachments ().fNoteSlides.size ()) {
     gIndenter++;
     list<S_msrSlide>::const_iterator i;
-    for (i=fNoteSlides.begin (); i!=fNoteSlides.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSlides.begin (); i!=getNoteAttachments ().fNoteSlides.end (); i++) {
       // browse the glissando
       msrBrowser<msrSlide> browser (v);
       browser.browse (*(*i));
@@ -4682,10 +4701,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the dynamics if any
-  if (fNoteDynamics.size ()) {
+  if (getNoteAttachments ().fNoteDynamics.size ()) {
     gIndenter++;
     list<S_msrDynamics>::const_iterator i;
-    for (i=fNoteDynamics.begin (); i!=fNoteDynamics.end (); i++) {
+    for (i=getNoteAttachments ().fNoteDynamics.begin (); i!=getNoteAttachments ().fNoteDynamics.end (); i++) {
       // browse the dynamics
       msrBrowser<msrDynamics> browser (v);
       browser.browse (*(*i));
@@ -4694,10 +4713,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the other dynamics if any
-  if (fNoteOtherDynamics.size ()) {
+  if (getNoteAttachments ().fNoteOtherDynamics.size ()) {
     gIndenter++;
     list<S_msrOtherDynamics>::const_iterator i;
-    for (i=fNoteOtherDynamics.begin (); i!=fNoteOtherDynamics.end (); i++) {
+    for (i=getNoteAttachments ().fNoteOtherDynamics.begin (); i!=getNoteAttachments ().fNoteOtherDynamics.end (); i++) {
       // browse the other dynamics
       msrBrowser<msrOtherDynamics> browser (v);
       browser.browse (*(*i));
@@ -4706,10 +4725,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the words if any
-  if (fNoteWords.size ()) {
+  if (getNoteAttachments ().fNoteWords.size ()) {
     gIndenter++;
     list<S_msrWords>::const_iterator i;
-    for (i=fNoteWords.begin (); i!=fNoteWords.end (); i++) {
+    for (i=getNoteAttachments ().fNoteWords.begin (); i!=getNoteAttachments ().fNoteWords.end (); i++) {
       // browse the words
       msrBrowser<msrWords> browser (v);
       browser.browse (*(*i));
@@ -4718,10 +4737,10 @@ void msrNote::browseData (basevisitor* v)
   }
   
   // browse the slurs if any
-  if (fNoteSlurs.size ()) {
+  if (getNoteAttachments ().fNoteSlurs.size ()) {
     gIndenter++;
     list<S_msrSlur>::const_iterator i;
-    for (i=fNoteSlurs.begin (); i!=fNoteSlurs.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSlurs.begin (); i!=getNoteAttachments ().fNoteSlurs.end (); i++) {
       // browse the slur
       msrBrowser<msrSlur> browser (v);
       browser.browse (*(*i));
@@ -4730,10 +4749,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the ligatures if any
-  if (fNoteLigatures.size ()) {
+  if (getNoteAttachments ().fNoteLigatures.size ()) {
     gIndenter++;
     list<S_msrLigature>::const_iterator i;
-    for (i=fNoteLigatures.begin (); i!=fNoteLigatures.end (); i++) {
+    for (i=getNoteAttachments ().fNoteLigatures.begin (); i!=getNoteAttachments ().fNoteLigatures.end (); i++) {
       // browse the ligature
       msrBrowser<msrLigature> browser (v);
       browser.browse (*(*i));
@@ -4742,10 +4761,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the pedals if any
-  if (fNotePedals.size ()) {
+  if (getNoteAttachments ().fNotePedals.size ()) {
     gIndenter++;
     list<S_msrPedal>::const_iterator i;
-    for (i=fNotePedals.begin (); i!=fNotePedals.end (); i++) {
+    for (i=getNoteAttachments ().fNotePedals.begin (); i!=getNoteAttachments ().fNotePedals.end (); i++) {
       // browse the pedal
       msrBrowser<msrPedal> browser (v);
       browser.browse (*(*i));
@@ -4754,10 +4773,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the wedges if any
-  if (fNoteSlashes.size ()) {
+  if (getNoteAttachments ().fNoteSlashes.size ()) {
     gIndenter++;
     list<S_msrSlash>::const_iterator i;
-    for (i=fNoteSlashes.begin (); i!=fNoteSlashes.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSlashes.begin (); i!=getNoteAttachments ().fNoteSlashes.end (); i++) {
       // browse the wedge
       msrBrowser<msrSlash> browser (v);
       browser.browse (*(*i));
@@ -4766,10 +4785,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the wedges if any
-  if (fNoteWedges.size ()) {
+  if (getNoteAttachments ().fNoteWedges.size ()) {
     gIndenter++;
     list<S_msrWedge>::const_iterator i;
-    for (i=fNoteWedges.begin (); i!=fNoteWedges.end (); i++) {
+    for (i=getNoteAttachments ().fNoteWedges.begin (); i!=getNoteAttachments ().fNoteWedges.end (); i++) {
       // browse the wedge
       msrBrowser<msrWedge> browser (v);
       browser.browse (*(*i));
@@ -4778,10 +4797,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the eyeglasses if any
-  if (fNoteEyeGlasses.size ()) {
+  if (getNoteAttachments ().fNoteEyeGlasses.size ()) {
     gIndenter++;
     list<S_msrEyeGlasses>::const_iterator i;
-    for (i=fNoteEyeGlasses.begin (); i!=fNoteEyeGlasses.end (); i++) {
+    for (i=getNoteAttachments ().fNoteEyeGlasses.begin (); i!=getNoteAttachments ().fNoteEyeGlasses.end (); i++) {
       // browse the eyeglasses
       msrBrowser<msrEyeGlasses> browser (v);
       browser.browse (*(*i));
@@ -4790,10 +4809,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the damps if any
-  if (fNoteDamps.size ()) {
+  if (getNoteAttachments ().fNoteDamps.size ()) {
     gIndenter++;
     list<S_msrDamp>::const_iterator i;
-    for (i=fNoteDamps.begin (); i!=fNoteDamps.end (); i++) {
+    for (i=getNoteAttachments ().fNoteDamps.begin (); i!=getNoteAttachments ().fNoteDamps.end (); i++) {
       // browse the damp
       msrBrowser<msrDamp> browser (v);
       browser.browse (*(*i));
@@ -4802,10 +4821,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the damp alls if any
-  if (fNoteDampAlls.size ()) {
+  if (getNoteAttachments ().fNoteDampAlls.size ()) {
     gIndenter++;
     list<S_msrDampAll>::const_iterator i;
-    for (i=fNoteDampAlls.begin (); i!=fNoteDampAlls.end (); i++) {
+    for (i=getNoteAttachments ().fNoteDampAlls.begin (); i!=getNoteAttachments ().fNoteDampAlls.end (); i++) {
       // browse the damp all
       msrBrowser<msrDampAll> browser (v);
       browser.browse (*(*i));
@@ -4814,10 +4833,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the scordaturas if any
-  if (fNoteScordaturas.size ()) {
+  if (getNoteAttachments ().fNoteScordaturas.size ()) {
     gIndenter++;
     list<S_msrScordatura>::const_iterator i;
-    for (i=fNoteScordaturas.begin (); i!=fNoteScordaturas.end (); i++) {
+    for (i=getNoteAttachments ().fNoteScordaturas.begin (); i!=getNoteAttachments ().fNoteScordaturas.end (); i++) {
       // browse the scordatura
       msrBrowser<msrScordatura> browser (v);
       browser.browse (*(*i));
@@ -4826,10 +4845,10 @@ void msrNote::browseData (basevisitor* v)
   }
 
   // browse the syllables if any
-  if (fNoteSyllables.size ()) {
+  if (getNoteAttachments ().fNoteSyllables.size ()) {
     gIndenter++;
     list<S_msrSyllable>::const_iterator i;
-    for (i=fNoteSyllables.begin (); i!=fNoteSyllables.end (); i++) {
+    for (i=getNoteAttachments ().fNoteSyllables.begin (); i!=getNoteAttachments ().fNoteSyllables.end (); i++) {
       // browse the syllable
       msrBrowser<msrSyllable> browser (v);
       browser.browse (*(*i));
@@ -6046,7 +6065,7 @@ void msrNote::print (ostream& os)
   }
 
   // print the syllables associated to this note if any
-  int noteSyllablesSize = fNoteSyllables.size ();
+  int noteSyllablesSize = getNoteAttachments ().fNoteSyllables.size ();
 
   if (noteSyllablesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
@@ -6059,8 +6078,8 @@ void msrNote::print (ostream& os)
       gIndenter++;
             
       list<S_msrSyllable>::const_iterator
-        iBegin = fNoteSyllables.begin (),
-        iEnd   = fNoteSyllables.end (),
+        iBegin = getNoteAttachments ().fNoteSyllables.begin (),
+        iEnd   = getNoteAttachments ().fNoteSyllables.end (),
         i      = iBegin;
       for ( ; ; ) {
         S_msrSyllable
@@ -6151,21 +6170,21 @@ void msrNote::print (ostream& os)
   }
     
   // print the beams if any
-  int noteBeamsSize = fNoteBeams.size ();
+  int noteBeamsSize = getNoteAttachments ().fNoteBeams.size ();
 
   if (noteBeamsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteBeams";
-    if (fNoteBeams.size ()) {
+    if (getNoteAttachments ().fNoteBeams.size ()) {
       os <<
         endl;
 
       gIndenter++;
         
       list<S_msrBeam>::const_iterator
-        iBegin = fNoteBeams.begin (),
-        iEnd   = fNoteBeams.end (),
+        iBegin = getNoteAttachments ().fNoteBeams.begin (),
+        iEnd   = getNoteAttachments ().fNoteBeams.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6183,21 +6202,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the articulations if any
-  int noteArticulationsSize = fNoteArticulations.size ();
+  int noteArticulationsSize = getNoteAttachments ().fNoteArticulations.size ();
 
   if (noteArticulationsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteArticulations";
-    if (fNoteArticulations.size ()) {
+    if (getNoteAttachments ().fNoteArticulations.size ()) {
       os <<
         endl;
 
       gIndenter++;
         
       list<S_msrArticulation>::const_iterator
-        iBegin = fNoteArticulations.begin (),
-        iEnd   = fNoteArticulations.end (),
+        iBegin = getNoteAttachments ().fNoteArticulations.begin (),
+        iEnd   = getNoteAttachments ().fNoteArticulations.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6215,21 +6234,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the spanners if any
-  int noteSpannersSize = fNoteSpanners.size ();
+  int noteSpannersSize = getNoteAttachments ().fNoteSpanners.size ();
 
   if (noteSpannersSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSpanners";
-    if (fNoteSpanners.size ()) {
+    if (getNoteAttachments ().fNoteSpanners.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrSpanner>::const_iterator
-        iBegin = fNoteSpanners.begin (),
-        iEnd   = fNoteSpanners.end (),
+        iBegin = getNoteAttachments ().fNoteSpanners.begin (),
+        iEnd   = getNoteAttachments ().fNoteSpanners.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6247,21 +6266,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the technicals if any
-  int noteTechnicalsSize = fNoteTechnicals.size ();
+  int noteTechnicalsSize = getNoteAttachments ().fNoteTechnicals.size ();
 
   if (noteTechnicalsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicals";
-    if (fNoteTechnicals.size ()) {
+    if (getNoteAttachments ().fNoteTechnicals.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrTechnical>::const_iterator
-        iBegin = fNoteTechnicals.begin (),
-        iEnd   = fNoteTechnicals.end (),
+        iBegin = getNoteAttachments ().fNoteTechnicals.begin (),
+        iEnd   = getNoteAttachments ().fNoteTechnicals.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6279,21 +6298,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the technicals with integer if any
-  int noteTechnicalWithIntegersSize = fNoteTechnicalWithIntegers.size ();
+  int noteTechnicalWithIntegersSize = getNoteAttachments ().fNoteTechnicalWithIntegers.size ();
 
   if (noteTechnicalWithIntegersSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithIntegers";
-    if (fNoteTechnicalWithIntegers.size ()) {
+    if (getNoteAttachments ().fNoteTechnicalWithIntegers.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrTechnicalWithInteger>::const_iterator
-        iBegin = fNoteTechnicalWithIntegers.begin (),
-        iEnd   = fNoteTechnicalWithIntegers.end (),
+        iBegin = getNoteAttachments ().fNoteTechnicalWithIntegers.begin (),
+        iEnd   = getNoteAttachments ().fNoteTechnicalWithIntegers.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6311,21 +6330,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the technicals with float if any
-  int noteTechnicalWithFloatsSize = fNoteTechnicalWithFloats.size ();
+  int noteTechnicalWithFloatsSize = getNoteAttachments ().fNoteTechnicalWithFloats.size ();
 
   if (noteTechnicalWithFloatsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithFloats";
-    if (fNoteTechnicalWithFloats.size ()) {
+    if (getNoteAttachments ().fNoteTechnicalWithFloats.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrTechnicalWithFloat>::const_iterator
-        iBegin = fNoteTechnicalWithFloats.begin (),
-        iEnd   = fNoteTechnicalWithFloats.end (),
+        iBegin = getNoteAttachments ().fNoteTechnicalWithFloats.begin (),
+        iEnd   = getNoteAttachments ().fNoteTechnicalWithFloats.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6343,21 +6362,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the technicals with string if any
-  int noteTechnicalWithStringsSize = fNoteTechnicalWithStrings.size ();
+  int noteTechnicalWithStringsSize = getNoteAttachments ().fNoteTechnicalWithStrings.size ();
 
   if (noteTechnicalWithStringsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteTechnicalWithStrings";
-    if (fNoteTechnicalWithStrings.size ()) {
+    if (getNoteAttachments ().fNoteTechnicalWithStrings.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrTechnicalWithString>::const_iterator
-        iBegin = fNoteTechnicalWithStrings.begin (),
-        iEnd   = fNoteTechnicalWithStrings.end (),
+        iBegin = getNoteAttachments ().fNoteTechnicalWithStrings.begin (),
+        iEnd   = getNoteAttachments ().fNoteTechnicalWithStrings.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6375,21 +6394,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the ornaments if any
-  int noteOrnamentsSize = fNoteOrnaments.size ();
+  int noteOrnamentsSize = getNoteAttachments ().fNoteOrnaments.size ();
 
   if (noteOrnamentsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteOrnaments";
-    if (fNoteOrnaments.size ()) {
+    if (getNoteAttachments ().fNoteOrnaments.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrOrnament>::const_iterator
-        iBegin = fNoteOrnaments.begin (),
-        iEnd   = fNoteOrnaments.end (),
+        iBegin = getNoteAttachments ().fNoteOrnaments.begin (),
+        iEnd   = getNoteAttachments ().fNoteOrnaments.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6407,21 +6426,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the glissandos if any
-  int noteGlissandosSize = fNoteGlissandos.size ();
+  int noteGlissandosSize = getNoteAttachments ().fNoteGlissandos.size ();
 
   if (noteGlissandosSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteGlissandos";
-    if (fNoteGlissandos.size ()) {
+    if (getNoteAttachments ().fNoteGlissandos.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrGlissando>::const_iterator
-        iBegin = fNoteGlissandos.begin (),
-        iEnd   = fNoteGlissandos.end (),
+        iBegin = getNoteAttachments ().fNoteGlissandos.begin (),
+        iEnd   = getNoteAttachments ().fNoteGlissandos.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6439,21 +6458,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the slides if any
-  int noteSlidesSize = fNoteSlides.size ();
+  int noteSlidesSize = getNoteAttachments ().fNoteSlides.size ();
 
   if (noteSlidesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlides";
-    if (fNoteSlides.size ()) {
+    if (getNoteAttachments ().fNoteSlides.size ()) {
       os <<
         endl;
 
       gIndenter++;
           
       list<S_msrSlide>::const_iterator
-        iBegin = fNoteSlides.begin (),
-        iEnd   = fNoteSlides.end (),
+        iBegin = getNoteAttachments ().fNoteSlides.begin (),
+        iEnd   = getNoteAttachments ().fNoteSlides.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6560,21 +6579,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the dynamics if any
-  int noteDynamicsSize = fNoteDynamics.size ();
+  int noteDynamicsSize = getNoteAttachments ().fNoteDynamics.size ();
 
   if (noteDynamicsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDynamics";
-    if (fNoteDynamics.size ()) {
+    if (getNoteAttachments ().fNoteDynamics.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrDynamics>::const_iterator
-        iBegin = fNoteDynamics.begin (),
-        iEnd   = fNoteDynamics.end (),
+        iBegin = getNoteAttachments ().fNoteDynamics.begin (),
+        iEnd   = getNoteAttachments ().fNoteDynamics.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6592,21 +6611,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the other dynamics if any
-  int noteOtherDynamicsSize = fNoteOtherDynamics.size ();
+  int noteOtherDynamicsSize = getNoteAttachments ().fNoteOtherDynamics.size ();
 
   if (noteOtherDynamicsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteOtherDynamics";
-    if (fNoteOtherDynamics.size ()) {
+    if (getNoteAttachments ().fNoteOtherDynamics.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrOtherDynamics>::const_iterator
-        iBegin = fNoteOtherDynamics.begin (),
-        iEnd   = fNoteOtherDynamics.end (),
+        iBegin = getNoteAttachments ().fNoteOtherDynamics.begin (),
+        iEnd   = getNoteAttachments ().fNoteOtherDynamics.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6624,20 +6643,20 @@ void msrNote::print (ostream& os)
   }
 
   // print the words if any
-  int noteWordsSize = fNoteWords.size ();
+  int noteWordsSize = getNoteAttachments ().fNoteWords.size ();
 
   if (noteWordsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteWords";
-    if (fNoteWords.size ()) {
+    if (getNoteAttachments ().fNoteWords.size ()) {
       gIndenter++;
             os <<
         endl;
 
       list<S_msrWords>::const_iterator
-        iBegin = fNoteWords.begin (),
-        iEnd   = fNoteWords.end (),
+        iBegin = getNoteAttachments ().fNoteWords.begin (),
+        iEnd   = getNoteAttachments ().fNoteWords.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6655,21 +6674,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the slurs if any
-  int noteSlursSize = fNoteSlurs.size ();
+  int noteSlursSize = getNoteAttachments ().fNoteSlurs.size ();
 
   if (noteSlursSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlurs";
-    if (fNoteSlurs.size ()) {
+    if (getNoteAttachments ().fNoteSlurs.size ()) {
       os <<
         endl;
 
       gIndenter++;
         
       list<S_msrSlur>::const_iterator
-        iBegin = fNoteSlurs.begin (),
-        iEnd   = fNoteSlurs.end (),
+        iBegin = getNoteAttachments ().fNoteSlurs.begin (),
+        iEnd   = getNoteAttachments ().fNoteSlurs.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6687,21 +6706,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the ligatures if any
-  int noteLigaturesSize = fNoteLigatures.size ();
+  int noteLigaturesSize = getNoteAttachments ().fNoteLigatures.size ();
 
   if (noteLigaturesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteLigatures";
-    if (fNoteLigatures.size ()) {
+    if (getNoteAttachments ().fNoteLigatures.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrLigature>::const_iterator
-        iBegin = fNoteLigatures.begin (),
-        iEnd   = fNoteLigatures.end (),
+        iBegin = getNoteAttachments ().fNoteLigatures.begin (),
+        iEnd   = getNoteAttachments ().fNoteLigatures.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6719,21 +6738,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the pedals if any
-  int notePedalsSize = fNotePedals.size ();
+  int notePedalsSize = getNoteAttachments ().fNotePedals.size ();
 
   if (notePedalsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "notePedals";
-    if (fNotePedals.size ()) {
+    if (getNoteAttachments ().fNotePedals.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrPedal>::const_iterator
-        iBegin = fNotePedals.begin (),
-        iEnd   = fNotePedals.end (),
+        iBegin = getNoteAttachments ().fNotePedals.begin (),
+        iEnd   = getNoteAttachments ().fNotePedals.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6751,21 +6770,21 @@ void msrNote::print (ostream& os)
   }
   
   // print the slashes if any
-  int noteSlashesSize = fNoteSlashes.size ();
+  int noteSlashesSize = getNoteAttachments ().fNoteSlashes.size ();
 
   if (noteSlashesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteSlashes";
-    if (fNoteSlashes.size ()) {
+    if (getNoteAttachments ().fNoteSlashes.size ()) {
       os <<
         endl;
 
       gIndenter++;
         
       list<S_msrSlash>::const_iterator
-        iBegin = fNoteSlashes.begin (),
-        iEnd   = fNoteSlashes.end (),
+        iBegin = getNoteAttachments ().fNoteSlashes.begin (),
+        iEnd   = getNoteAttachments ().fNoteSlashes.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6783,21 +6802,21 @@ void msrNote::print (ostream& os)
       }
 
   // print the wedges if any
-  int noteWedgesSize = fNoteWedges.size ();
+  int noteWedgesSize = getNoteAttachments ().fNoteWedges.size ();
 
   if (noteWedgesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteWedges";
-    if (fNoteWedges.size ()) {
+    if (getNoteAttachments ().fNoteWedges.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrWedge>::const_iterator
-        iBegin = fNoteWedges.begin (),
-        iEnd   = fNoteWedges.end (),
+        iBegin = getNoteAttachments ().fNoteWedges.begin (),
+        iEnd   = getNoteAttachments ().fNoteWedges.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6815,21 +6834,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the eyeglasses if any
-  int noteEyeGlassesSize = fNoteEyeGlasses.size ();
+  int noteEyeGlassesSize = getNoteAttachments ().fNoteEyeGlasses.size ();
 
   if (noteEyeGlassesSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteEyeGlasses";
-    if (fNoteEyeGlasses.size ()) {
+    if (getNoteAttachments ().fNoteEyeGlasses.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrEyeGlasses>::const_iterator
-        iBegin = fNoteEyeGlasses.begin (),
-        iEnd   = fNoteEyeGlasses.end (),
+        iBegin = getNoteAttachments ().fNoteEyeGlasses.begin (),
+        iEnd   = getNoteAttachments ().fNoteEyeGlasses.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6847,21 +6866,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the damps if any
-  int noteDampsSize = fNoteDamps.size ();
+  int noteDampsSize = getNoteAttachments ().fNoteDamps.size ();
 
   if (noteDampsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDamps";
-    if (fNoteDamps.size ()) {
+    if (getNoteAttachments ().fNoteDamps.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrDamp>::const_iterator
-        iBegin = fNoteDamps.begin (),
-        iEnd   = fNoteDamps.end (),
+        iBegin = getNoteAttachments ().fNoteDamps.begin (),
+        iEnd   = getNoteAttachments ().fNoteDamps.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6879,21 +6898,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the dampAlls if any
-  int noteDampAllsSize = fNoteDampAlls.size ();
+  int noteDampAllsSize = getNoteAttachments ().fNoteDampAlls.size ();
 
   if (noteDampAllsSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteDampAlls";
-    if (fNoteDampAlls.size ()) {
+    if (getNoteAttachments ().fNoteDampAlls.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrDampAll>::const_iterator
-        iBegin = fNoteDampAlls.begin (),
-        iEnd   = fNoteDampAlls.end (),
+        iBegin = getNoteAttachments ().fNoteDampAlls.begin (),
+        iEnd   = getNoteAttachments ().fNoteDampAlls.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -6911,21 +6930,21 @@ void msrNote::print (ostream& os)
   }
 
   // print the scordaturas if any
-  int noteScordaturasSize = fNoteScordaturas.size ();
+  int noteScordaturasSize = getNoteAttachments ().fNoteScordaturas.size ();
 
   if (noteScordaturasSize > 0 || gMsrOptions->fDisplayMsrDetails) {
     os <<
       setw (fieldWidth) <<
       "noteScordaturas";
-    if (fNoteScordaturas.size ()) {
+    if (getNoteAttachments ().fNoteScordaturas.size ()) {
       os <<
         endl;
 
       gIndenter++;
               
       list<S_msrScordatura>::const_iterator
-        iBegin = fNoteScordaturas.begin (),
-        iEnd   = fNoteScordaturas.end (),
+        iBegin = getNoteAttachments ().fNoteScordaturas.begin (),
+        iEnd   = getNoteAttachments ().fNoteScordaturas.end (),
         i      = iBegin;
       for ( ; ; ) {
         os << (*i);
@@ -7071,6 +7090,25 @@ msrChord::msrChord (
 msrChord::~msrChord ()
 {}
 
+const msrChordAttachments& msrChord::getChordAttachments () const
+{
+  static const msrChordAttachments noAttachments;
+
+  return
+    fChordAttachments
+      ? *fChordAttachments
+      : noAttachments;
+}
+
+msrChordAttachments& msrChord::getChordAttachmentsToModify ()
+{
+  if (! fChordAttachments) {
+    fChordAttachments.reset (new msrChordAttachments);
+  }
+  
+  return *fChordAttachments;
+}
+
 S_msrChord msrChord::createChordNewbornClone (
   S_msrPart containingPart)
 {
@@ -7272,8 +7310,8 @@ void msrChord::appendArticulationToChord (S_msrArticulation art)
 
   // don't append the same articulation several times
   for (
-    list<S_msrArticulation>::const_iterator i = fChordArticulations.begin ();
-    i!=fChordArticulations.end ();
+    list<S_msrArticulation>::const_iterator i = getChordAttachments ().fChordArticulations.begin ();
+    i!=getChordAttachments ().fChordArticulations.end ();
     i++) {
       if ((*i)->getArticulationKind () == articulationKind)
         return;
@@ -7289,7 +7327,7 @@ void msrChord::appendArticulationToChord (S_msrArticulation art)
   }
 #endif
 
-  fChordArticulations.push_back (art);
+  getChordAttachmentsToModify ().fChordArticulations.push_back (art);
 }
 
 void msrChord::appendSpannerToChord (S_msrSpanner span)
@@ -7301,8 +7339,8 @@ void msrChord::appendSpannerToChord (S_msrSpanner span)
 
   // don't append the same spanner several times
   for (
-    list<S_msrSpanner>::const_iterator i = fChordSpanners.begin ();
-    i!=fChordSpanners.end ();
+    list<S_msrSpanner>::const_iterator i = getChordAttachments ().fChordSpanners.begin ();
+    i!=getChordAttachments ().fChordSpanners.end ();
     i++) {
       if ((*i)->getSpannerKind () == spannerKind)
         return;
@@ -7320,7 +7358,7 @@ void msrChord::appendSpannerToChord (S_msrSpanner span)
   }
 #endif
 
-  fChordSpanners.push_back (span);
+  getChordAttachmentsToModify ().fChordSpanners.push_back (span);
 }
 
 void msrChord::setChordSingleTremolo (S_msrSingleTremolo trem)
@@ -7348,8 +7386,8 @@ void msrChord::appendTechnicalToChord (S_msrTechnical tech)
   // don't append the same technical several times
   for (
     list<S_msrTechnical>::const_iterator i =
-      fChordTechnicals.begin ();
-    i!=fChordTechnicals.end ();
+      getChordAttachments ().fChordTechnicals.begin ();
+    i!=getChordAttachments ().fChordTechnicals.end ();
     i++) {
       if ((*i)->getTechnicalKind () == technicalKind)
         return;
@@ -7365,7 +7403,7 @@ void msrChord::appendTechnicalToChord (S_msrTechnical tech)
   }
 #endif
 
-  fChordTechnicals.push_back (tech);
+  getChordAttachmentsToModify ().fChordTechnicals.push_back (tech);
 }
 
 void msrChord::appendTechnicalWithIntegerToChord (
@@ -7379,8 +7417,8 @@ void msrChord::appendTechnicalWithIntegerToChord (
   // don't append the same technical several times
   for (
     list<S_msrTechnicalWithInteger>::const_iterator i =
-      fChordTechnicalWithIntegers.begin ();
-    i!=fChordTechnicalWithIntegers.end ();
+      getChordAttachments ().fChordTechnicalWithIntegers.begin ();
+    i!=getChordAttachments ().fChordTechnicalWithIntegers.end ();
     i++) {
       if ((*i)->getTechnicalWithIntegerKind () == technicalWithIntegerKind)
         return;
@@ -7396,7 +7434,7 @@ void msrChord::appendTechnicalWithIntegerToChord (
   }
 #endif
 
-  fChordTechnicalWithIntegers.push_back (tech);
+  getChordAttachmentsToModify ().fChordTechnicalWithIntegers.push_back (tech);
 }
 
 void msrChord::appendTechnicalWithFloatToChord (
@@ -7410,8 +7448,8 @@ void msrChord::appendTechnicalWithFloatToChord (
   // don't append the same technical several times
   for (
     list<S_msrTechnicalWithFloat>::const_iterator i =
-      fChordTechnicalWithFloats.begin ();
-    i!=fChordTechnicalWithFloats.end ();
+      getChordAttachments ().fChordTechnicalWithFloats.begin ();
+    i!=getChordAttachments ().fChordTechnicalWithFloats.end ();
     i++) {
       if ((*i)->getTechnicalWithFloatKind () == technicalWithFloatKind)
         return;
@@ -7427,7 +7465,7 @@ void msrChord::appendTechnicalWithFloatToChord (
   }
 #endif
 
-  fChordTechnicalWithFloats.push_back (tech);
+  getChordAttachmentsToModify ().fChordTechnicalWithFloats.push_back (tech);
 }
 
 void msrChord::appendTechnicalWithStringToChord (
@@ -7441,8 +7479,8 @@ void msrChord::appendTechnicalWithStringToChord (
   // don't append the same technical several times
   for (
     list<S_msrTechnicalWithString>::const_iterator i =
-      fChordTechnicalWithStrings.begin ();
-    i!=fChordTechnicalWithStrings.end ();
+      getChordAttachments ().fChordTechnicalWithStrings.begin ();
+    i!=getChordAttachments ().fChordTechnicalWithStrings.end ();
     i++) {
       if ((*i)->getTechnicalWithStringKind () == technicalWithStringKind)
         return;
@@ -7458,7 +7496,7 @@ void msrChord::appendTechnicalWithStringToChord (
   }
 #endif
 
-  fChordTechnicalWithStrings.push_back (tech);
+  getChordAttachmentsToModify ().fChordTechnicalWithStrings.push_back (tech);
 }
 
 void msrChord::appendOrnamentToChord (S_msrOrnament orn)
@@ -7470,8 +7508,8 @@ void msrChord::appendOrnamentToChord (S_msrOrnament orn)
 
   // don't append the same ornament several times
   for (
-    list<S_msrOrnament>::const_iterator i = fChordOrnaments.begin ();
-    i!=fChordOrnaments.end ();
+    list<S_msrOrnament>::const_iterator i = getChordAttachments ().fChordOrnaments.begin ();
+    i!=getChordAttachments ().fChordOrnaments.end ();
     i++) {
       if ((*i)->getOrnamentKind () == ornamentKind)
         return;
@@ -7487,7 +7525,7 @@ void msrChord::appendOrnamentToChord (S_msrOrnament orn)
   }
 #endif
 
-  fChordOrnaments.push_back (orn);
+  getChordAttachmentsToModify ().fChordOrnaments.push_back (orn);
 }
 
 void msrChord::appendGlissandoToChord (S_msrGlissando gliss)
@@ -7499,8 +7537,8 @@ void msrChord::appendGlissandoToChord (S_msrGlissando gliss)
 
   // don't append the same slissando several times
   for (
-    list<S_msrGlissando>::const_iterator i = fChordGlissandos.begin ();
-    i!=fChordGlissandos.end ();
+    list<S_msrGlissando>::const_iterator i = getChordAttachments ().fChordGlissandos.begin ();
+    i!=getChordAttachments ().fChordGlissandos.end ();
     i++) {
       if ((*i)->getGlissandoTypeKind () == glissandoTypeKind)
         return;
@@ -7516,7 +7554,7 @@ void msrChord::appendGlissandoToChord (S_msrGlissando gliss)
   }
 #endif
 
-  fChordGlissandos.push_back (gliss);
+  getChordAttachmentsToModify ().fChordGlissandos.push_back (gliss);
 }
 
 void msrChord::appendSlideToChord (S_msrSlide slide)
@@ -7528,8 +7566,8 @@ void msrChord::appendSlideToChord (S_msrSlide slide)
 
   // don't append the same slide several times
   for (
-    list<S_msrSlide>::const_iterator i = fChordSlides.begin ();
-    i!=fChordSlides.end ();
+    list<S_msrSlide>::const_iterator i = getChordAttachments ().fChordSlides.begin ();
+    i!=getChordAttachments ().fChordSlides.end ();
     i++) {
       if ((*i)->getSlideTypeKind () == slideTypeKind)
         return;
@@ -7545,7 +7583,7 @@ void msrChord::appendSlideToChord (S_msrSlide slide)
   }
 #endif
 
-  fChordSlides.push_back (slide);
+  getChordAttachmentsToModify ().fChordSlides.push_back (slide);
 }
 
 void msrChord::appendBeamToChord (S_msrBeam beam)
@@ -7560,7 +7598,7 @@ void msrChord::appendBeamToChord (S_msrBeam beam)
   }
 #endif
 
-  fChordBeams.push_back (beam);
+  getChordAttachmentsToModify ().fChordBeams.push_back (beam);
 }
 
 void msrChord::acceptIn (basevisitor* v)
@@ -7619,8 +7657,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrArticulation>::const_iterator i = fChordArticulations.begin ();
-    i != fChordArticulations.end ();
+    list<S_msrArticulation>::const_iterator i = getChordAttachments ().fChordArticulations.begin ();
+    i != getChordAttachments ().fChordArticulations.end ();
     i++ ) {
     // browse the articulation
     msrBrowser<msrArticulation> browser (v);
@@ -7628,8 +7666,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrSpanner>::const_iterator i = fChordSpanners.begin ();
-    i != fChordSpanners.end ();
+    list<S_msrSpanner>::const_iterator i = getChordAttachments ().fChordSpanners.begin ();
+    i != getChordAttachments ().fChordSpanners.end ();
     i++ ) {
     // browse the spanner
     msrBrowser<msrSpanner> browser (v);
@@ -7637,8 +7675,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrTechnical>::const_iterator i = fChordTechnicals.begin ();
-    i != fChordTechnicals.end ();
+    list<S_msrTechnical>::const_iterator i = getChordAttachments ().fChordTechnicals.begin ();
+    i != getChordAttachments ().fChordTechnicals.end ();
     i++ ) {
     // browse the technical
     msrBrowser<msrTechnical> browser (v);
@@ -7646,8 +7684,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrOrnament>::const_iterator i = fChordOrnaments.begin ();
-    i != fChordOrnaments.end ();
+    list<S_msrOrnament>::const_iterator i = getChordAttachments ().fChordOrnaments.begin ();
+    i != getChordAttachments ().fChordOrnaments.end ();
     i++ ) {
     // browse the ornament
     msrBrowser<msrOrnament> browser (v);
@@ -7655,8 +7693,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrGlissando>::const_iterator i = fChordGlissandos.begin ();
-    i != fChordGlissandos.end ();
+    list<S_msrGlissando>::const_iterator i = getChordAttachments ().fChordGlissandos.begin ();
+    i != getChordAttachments ().fChordGlissandos.end ();
     i++ ) {
     // browse the glissando
     msrBrowser<msrGlissando> browser (v);
@@ -7664,8 +7702,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrSlide>::const_iterator i = fChordSlides.begin ();
-    i != fChordSlides.end ();
+    list<S_msrSlide>::const_iterator i = getChordAttachments ().fChordSlides.begin ();
+    i != getChordAttachments ().fChordSlides.end ();
     i++ ) {
     // browse the slide
     msrBrowser<msrSlide> browser (v);
@@ -7673,8 +7711,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrDynamics>::const_iterator i = fChordDynamics.begin ();
-    i != fChordDynamics.end ();
+    list<S_msrDynamics>::const_iterator i = getChordAttachments ().fChordDynamics.begin ();
+    i != getChordAttachments ().fChordDynamics.end ();
     i++ ) {
     // browse the dynamics
     msrBrowser<msrDynamics> browser (v);
@@ -7682,8 +7720,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrOtherDynamics>::const_iterator i = fChordOtherDynamics.begin ();
-    i != fChordOtherDynamics.end ();
+    list<S_msrOtherDynamics>::const_iterator i = getChordAttachments ().fChordOtherDynamics.begin ();
+    i != getChordAttachments ().fChordOtherDynamics.end ();
     i++ ) {
     // browse the other dynamics
     msrBrowser<msrOtherDynamics> browser (v);
@@ -7691,8 +7729,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrWords>::const_iterator i = fChordWords.begin ();
-    i != fChordWords.end ();
+    list<S_msrWords>::const_iterator i = getChordAttachments ().fChordWords.begin ();
+    i != getChordAttachments ().fChordWords.end ();
     i++ ) {
     // browse the words
     msrBrowser<msrWords> browser (v);
@@ -7700,8 +7738,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrTie>::const_iterator i = fChordTies.begin ();
-    i != fChordTies.end ();
+    list<S_msrTie>::const_iterator i = getChordAttachments ().fChordTies.begin ();
+    i != getChordAttachments ().fChordTies.end ();
     i++ ) {
     // browse the tie
     msrBrowser<msrTie> browser (v);
@@ -7709,8 +7747,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
   
   for (
-    list<S_msrSlur>::const_iterator i = fChordSlurs.begin ();
-    i != fChordSlurs.end ();
+    list<S_msrSlur>::const_iterator i = getChordAttachments ().fChordSlurs.begin ();
+    i != getChordAttachments ().fChordSlurs.end ();
     i++ ) {
     // browse the slur
     msrBrowser<msrSlur> browser (v);
@@ -7718,8 +7756,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
   
   for (
-    list<S_msrLigature>::const_iterator i = fChordLigatures.begin ();
-    i != fChordLigatures.end ();
+    list<S_msrLigature>::const_iterator i = getChordAttachments ().fChordLigatures.begin ();
+    i != getChordAttachments ().fChordLigatures.end ();
     i++ ) {
     // browse the ligature
     msrBrowser<msrLigature> browser (v);
@@ -7727,8 +7765,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
   
   for (
-    list<S_msrSlash>::const_iterator i = fChordSlashes.begin ();
-    i != fChordSlashes.end ();
+    list<S_msrSlash>::const_iterator i = getChordAttachments ().fChordSlashes.begin ();
+    i != getChordAttachments ().fChordSlashes.end ();
     i++ ) {
     // browse the slash
     msrBrowser<msrSlash> browser (v);
@@ -7736,8 +7774,8 @@ void msrChord::browseData (basevisitor* v)
   } // for
 
   for (
-    list<S_msrWedge>::const_iterator i = fChordWedges.begin ();
-    i != fChordWedges.end ();
+    list<S_msrWedge>::const_iterator i = getChordAttachments ().fChordWedges.begin ();
+    i != getChordAttachments ().fChordWedges.end ();
     i++ ) {
     // browse the wedge
     msrBrowser<msrWedge> browser (v);
@@ -8027,79 +8065,79 @@ void msrChord::print (ostream& os)
   }
   
   // print the articulations if any
-  if (fChordArticulations.size ()) {
+  if (getChordAttachments ().fChordArticulations.size ()) {
     list<S_msrArticulation>::const_iterator i;
-    for (i=fChordArticulations.begin (); i!=fChordArticulations.end (); i++) {
+    for (i=getChordAttachments ().fChordArticulations.begin (); i!=getChordAttachments ().fChordArticulations.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the spanners if any
-  if (fChordSpanners.size ()) {
+  if (getChordAttachments ().fChordSpanners.size ()) {
     list<S_msrSpanner>::const_iterator i;
-    for (i=fChordSpanners.begin (); i!=fChordSpanners.end (); i++) {
+    for (i=getChordAttachments ().fChordSpanners.begin (); i!=getChordAttachments ().fChordSpanners.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the technicals if any
-  if (fChordTechnicals.size ()) {
+  if (getChordAttachments ().fChordTechnicals.size ()) {
     list<S_msrTechnical>::const_iterator i;
-    for (i=fChordTechnicals.begin (); i!=fChordTechnicals.end (); i++) {
+    for (i=getChordAttachments ().fChordTechnicals.begin (); i!=getChordAttachments ().fChordTechnicals.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the ornaments if any
-  if (fChordOrnaments.size ()) {
+  if (getChordAttachments ().fChordOrnaments.size ()) {
     list<S_msrOrnament>::const_iterator i;
-    for (i=fChordOrnaments.begin (); i!=fChordOrnaments.end (); i++) {
+    for (i=getChordAttachments ().fChordOrnaments.begin (); i!=getChordAttachments ().fChordOrnaments.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the glissandos if any
-  if (fChordGlissandos.size ()) {
+  if (getChordAttachments ().fChordGlissandos.size ()) {
     list<S_msrGlissando>::const_iterator i;
-    for (i=fChordGlissandos.begin (); i!=fChordGlissandos.end (); i++) {
+    for (i=getChordAttachments ().fChordGlissandos.begin (); i!=getChordAttachments ().fChordGlissandos.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the slides if any
-  if (fChordSlides.size ()) {
+  if (getChordAttachments ().fChordSlides.size ()) {
     list<S_msrSlide>::const_iterator i;
-    for (i=fChordSlides.begin (); i!=fChordSlides.end (); i++) {
+    for (i=getChordAttachments ().fChordSlides.begin (); i!=getChordAttachments ().fChordSlides.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the dynamics if any
-  if (fChordDynamics.size ()) {
+  if (getChordAttachments ().fChordDynamics.size ()) {
     list<S_msrDynamics>::const_iterator i;
-    for (i=fChordDynamics.begin (); i!=fChordDynamics.end (); i++) {
+    for (i=getChordAttachments ().fChordDynamics.begin (); i!=getChordAttachments ().fChordDynamics.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the other dynamics if any
-  if (fChordOtherDynamics.size ()) {
+  if (getChordAttachments ().fChordOtherDynamics.size ()) {
     list<S_msrOtherDynamics>::const_iterator i;
-    for (i=fChordOtherDynamics.begin (); i!=fChordOtherDynamics.end (); i++) {
+    for (i=getChordAttachments ().fChordOtherDynamics.begin (); i!=getChordAttachments ().fChordOtherDynamics.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the stems if any
-  if (fChordStems.size ()) {
+  if (getChordAttachments ().fChordStems.size ()) {
     list<S_msrStem>::const_iterator i;
-    for (i=fChordStems.begin (); i!=fChordStems.end (); i++) {
+    for (i=getChordAttachments ().fChordStems.begin (); i!=getChordAttachments ().fChordStems.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the beams if any
-  int chordBeamsSize = fChordBeams.size ();
+  int chordBeamsSize = getChordAttachments ().fChordBeams.size ();
   
   if (chordBeamsSize || gMsrOptions->fDisplayMsrDetails) {
     os <<
@@ -8111,7 +8149,7 @@ void msrChord::print (ostream& os)
       gIndenter++;
   
       list<S_msrBeam>::const_iterator i;
-      for (i=fChordBeams.begin (); i!=fChordBeams.end (); i++) {
+      for (i=getChordAttachments ().fChordBeams.begin (); i!=getChordAttachments ().fChordBeams.end (); i++) {
         os << (*i);
       } // for
       
@@ -8125,49 +8163,49 @@ void msrChord::print (ostream& os)
   }
 
   // print the words if any
-  if (fChordWords.size ()) {
+  if (getChordAttachments ().fChordWords.size ()) {
     list<S_msrWords>::const_iterator i;
-    for (i=fChordWords.begin (); i!=fChordWords.end (); i++) {
+    for (i=getChordAttachments ().fChordWords.begin (); i!=getChordAttachments ().fChordWords.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the ties if any
-  if (fChordTies.size ()) {
+  if (getChordAttachments ().fChordTies.size ()) {
     list<S_msrTie>::const_iterator i;
-    for (i=fChordTies.begin (); i!=fChordTies.end (); i++) {
+    for (i=getChordAttachments ().fChordTies.begin (); i!=getChordAttachments ().fChordTies.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the slurs if any
-  if (fChordSlurs.size ()) {
+  if (getChordAttachments ().fChordSlurs.size ()) {
     list<S_msrSlur>::const_iterator i;
-    for (i=fChordSlurs.begin (); i!=fChordSlurs.end (); i++) {
+    for (i=getChordAttachments ().fChordSlurs.begin (); i!=getChordAttachments ().fChordSlurs.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the ligatures if any
-  if (fChordLigatures.size ()) {
+  if (getChordAttachments ().fChordLigatures.size ()) {
     list<S_msrLigature>::const_iterator i;
-    for (i=fChordLigatures.begin (); i!=fChordLigatures.end (); i++) {
+    for (i=getChordAttachments ().fChordLigatures.begin (); i!=getChordAttachments ().fChordLigatures.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the slashes if any
-  if (fChordSlashes.size ()) {
+  if (getChordAttachments ().fChordSlashes.size ()) {
     list<S_msrSlash>::const_iterator i;
-    for (i=fChordSlashes.begin (); i!=fChordSlashes.end (); i++) {
+    for (i=getChordAttachments ().fChordSlashes.begin (); i!=getChordAttachments ().fChordSlashes.end (); i++) {
       os << (*i);
     } // for
   }
 
   // print the wedges if any
-  if (fChordWedges.size ()) {
+  if (getChordAttachments ().fChordWedges.size ()) {
     list<S_msrWedge>::const_iterator i;
-    for (i=fChordWedges.begin (); i!=fChordWedges.end (); i++) {
+    for (i=getChordAttachments ().fChordWedges.begin (); i!=getChordAttachments ().fChordWedges.end (); i++) {
       os << (*i);
     } // for
   }
@@ -8677,7 +8715,8 @@ S_msrNote msrTuplet::removeFirstNoteFromTuplet (
     if (
       S_msrNote note = dynamic_cast<msrNote*>(&(*firstTupletElement))
       ) {
-      fTupletElementsList.pop_front ();
+      fTupletElementsList.erase (
+        fTupletElementsList.begin ());
       result = note;
     }
     
@@ -8852,7 +8891,7 @@ rational msrTuplet::setTupletPositionInMeasure (
   
   // compute position in measure for the tuplets elements
   for (
-    list<S_msrElement>::const_iterator i = fTupletElementsList.begin ();
+    vector<S_msrElement>::const_iterator i = fTupletElementsList.begin ();
     i != fTupletElementsList.end ();
     i++ ) {
     // set tuplet element position in measure
@@ -8998,7 +9037,7 @@ void msrTuplet::acceptOut (basevisitor* v)
 void msrTuplet::browseData (basevisitor* v)
 {
   for (
-    list<S_msrElement>::const_iterator i = fTupletElementsList.begin ();
+    vector<S_msrElement>::const_iterator i = fTupletElementsList.begin ();
     i != fTupletElementsList.end ();
     i++ ) {
     // browse tuplet element
@@ -9029,7 +9068,7 @@ string msrTuplet::asString () const
   s << "[[";
 
   if (fTupletElementsList.size ()) {
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = fTupletElementsList.begin (),
       iEnd   = fTupletElementsList.end (),
       i      = iBegin;
@@ -9145,7 +9184,7 @@ void msrTuplet::print (ostream& os)
   if (fTupletElementsList.size ()) {
     gIndenter++;
 
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = fTupletElementsList.begin (),
       iEnd   = fTupletElementsList.end (),
       i      = iBegin;
@@ -9235,7 +9274,7 @@ void msrTuplet::printShort (ostream& os)
       
     gIndenter++;
 
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = fTupletElementsList.begin (),
       iEnd   = fTupletElementsList.end (),
       i      = iBegin;
@@ -12193,33 +12232,6 @@ void msrMeasure::initializeMeasure ()
   }
 #endif
 
-  static int counter = 0;
-  
-  counter++;
-      
-  if (
-    false &&
-    fMeasureNumber == "11"
-      &&
-    fMeasureSegmentUplink->getSegmentAbsoluteNumber () == 4
-      &&
-    counter == 1
-    ) {
-    gLogIOstream <<
-      endl <<
-      "======================= initializeMeasure()" <<
-      endl <<
-
-      fMeasureSegmentUplink->
-        getSegmentVoiceUplink () <<
-      
-      "=======================" <<
-      endl <<
-      endl;
-
-    abort ();
-  }
-  
   // measure kind
   fMeasureKind = kUnknownMeasureKind;
 
@@ -12433,7 +12445,7 @@ S_msrMeasure msrMeasure::createMeasureDeepCopy (
 #endif
     
     for (
-      list<S_msrElement>::const_iterator i = fMeasureElementsList.begin ();
+      vector<S_msrElement>::const_iterator i = fMeasureElementsList.begin ();
       i != fMeasureElementsList.end ();
       i++ ) {
       S_msrElement element = (*i);
@@ -12911,7 +12923,8 @@ void msrMeasure::appendBarlineToMeasure (S_msrBarline barline)
 void msrMeasure::prependBarlineToMeasure (S_msrBarline barline)
 {
   // append it to the measure elements list
-  fMeasureElementsList.push_front (barline);
+  fMeasureElementsList.insert (
+    fMeasureElementsList.begin (), barline);
 }
 
 void msrMeasure::appendSegnoToMeasure (S_msrSegno segno)
@@ -13876,7 +13889,8 @@ void msrMeasure::appendBarNumberCheckToMeasure (
 
 void msrMeasure::prependOtherElementToMeasure (S_msrElement elem)
 {
-  fMeasureElementsList.push_front (elem); // JMI
+  fMeasureElementsList.insert (
+    fMeasureElementsList.begin (), elem); // JMI
 
   // this measure contains music
   fMeasureContainsMusic = true;
@@ -13913,7 +13927,7 @@ void msrMeasure::removeNoteFromMeasure (
 #endif
 
   for (
-    list<S_msrElement>::iterator i=fMeasureElementsList.begin ();
+    vector<S_msrElement>::iterator i=fMeasureElementsList.begin ();
     i!=fMeasureElementsList.end ();
     ++i) {
     if ((*i) == note) {
@@ -14019,7 +14033,7 @@ void msrMeasure::removeElementFromMeasure (
 #endif
   
   for (
-    list<S_msrElement>::iterator i=fMeasureElementsList.begin ();
+    vector<S_msrElement>::iterator i=fMeasureElementsList.begin ();
     i!=fMeasureElementsList.end ();
     ++i) {
     if ((*i) == element) {
@@ -14461,7 +14475,7 @@ void msrMeasure::browseData (basevisitor* v)
   }
 
   for (
-    list<S_msrElement>::const_iterator i = fMeasureElementsList.begin ();
+    vector<S_msrElement>::const_iterator i = fMeasureElementsList.begin ();
     i != fMeasureElementsList.end ();
     i++) {
     // browse the element
@@ -14719,7 +14733,7 @@ void msrMeasure::print (ostream& os)
     
     gIndenter++;
     
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = fMeasureElementsList.begin (),
       iEnd   = fMeasureElementsList.end (),
       i      = iBegin;
@@ -14742,8 +14756,6 @@ ostream& operator<< (ostream& os, const S_msrMeasure& elt)
 }
 
 //______________________________________________________________________________
-int msrSegment::gSegmentsCounter = 0;
-
 S_msrSegment msrSegment::create (
   int        inputLineNumber,
   S_msrVoice segmentVoicekUplink)
@@ -14780,7 +14792,8 @@ msrSegment::~msrSegment ()
 
 void msrSegment::initializeSegment ()
 {
-  fSegmentAbsoluteNumber = ++gSegmentsCounter;
+  fSegmentAbsoluteNumber =
+    ++conversionContext::current ().fSegmentsCounter;
   
 #ifdef TRACE_OPTIONS
   if (gTraceOptions->fTraceSegments) {
@@ -14908,7 +14921,7 @@ S_msrSegment msrSegment::createSegmentDeepCopy (
 #endif
     
     for (
-      list<S_msrMeasure>::const_iterator i = fSegmentMeasuresList.begin ();
+      vector<S_msrMeasure>::const_iterator i = fSegmentMeasuresList.begin ();
       i != fSegmentMeasuresList.end ();
       i++) {
       // append a deep copy of the measure to the deep copy
@@ -16984,7 +16997,7 @@ void msrSegment::browseData (basevisitor* v)
     */
     
   for (
-    list<S_msrMeasure>::const_iterator i = fSegmentMeasuresList.begin ();
+    vector<S_msrMeasure>::const_iterator i = fSegmentMeasuresList.begin ();
     i != fSegmentMeasuresList.end ();
     i++) {
     // browse the element
@@ -17068,7 +17081,7 @@ void msrSegment::print (ostream& os)
   }
   
   else {        
-    list<S_msrMeasure>::const_iterator
+    vector<S_msrMeasure>::const_iterator
       iBegin = fSegmentMeasuresList.begin (),
       iEnd   = fSegmentMeasuresList.end (),
       i      = iBegin;
@@ -19169,9 +19182,6 @@ ostream& operator<< (ostream& os, const S_msrRepeatCoda& elt)
 }
 
 //______________________________________________________________________________ 
-// global variable
-int msrVoice::gVoicesCounter = 0;
-
 S_msrVoice msrVoice::create (
   int          inputLineNumber,
   msrVoiceKind voiceKind,
@@ -19438,6 +19448,7 @@ void msrVoice::initializeVoice (
   fVoiceActualHarmoniesCounter = 0;
 
   // multiple rests
+  fVoiceContainsMultipleRests = false;
   fVoiceRemainingRestMeasures = 0;
 
   // get the initial staff details from the staff if any
@@ -19681,7 +19692,7 @@ S_msrVoice msrVoice::createVoiceDeepCopy (
     }
 #endif
 
-   list<S_msrElement>::const_iterator
+   vector<S_msrElement>::const_iterator
       iBegin = fVoiceInitialElementsList.begin (),
       iEnd   = fVoiceInitialElementsList.end (),
       i      = iBegin;
@@ -20507,7 +20518,7 @@ S_msrNote msrVoice::fetchVoiceFirstNonGraceNote () const
 
   if (fVoiceFirstSegment) {
     // get the segment's measures list
-    const list<S_msrMeasure>&
+    const vector<S_msrMeasure>&
       firstSegmentMeasuresList =
         fVoiceFirstSegment->
           getSegmentMeasuresList ();
@@ -20519,7 +20530,7 @@ S_msrNote msrVoice::fetchVoiceFirstNonGraceNote () const
           firstSegmentMeasuresList.front ();
 
       // get the first measure's elements list
-      const list<S_msrElement>&
+      const vector<S_msrElement>&
         firstMeasureElementsList =
           firstMeasure->
             getMeasureElementsList ();
@@ -20530,7 +20541,7 @@ S_msrNote msrVoice::fetchVoiceFirstNonGraceNote () const
       // possibly inside a chord or tuplet
 
       if (firstMeasureElementsList.size ()) {
-        list<S_msrElement>::const_iterator
+        vector<S_msrElement>::const_iterator
           iBegin = firstMeasureElementsList.begin (),
           iEnd   = firstMeasureElementsList.end (),
           i      = iBegin;
@@ -21802,7 +21813,7 @@ S_msrMeasure msrVoice::fetchVoiceLastMeasure (
     fVoiceLastSegment != 0,
     "fVoiceLastSegment is null");
 
-  const list<S_msrMeasure>&
+  const vector<S_msrMeasure>&
     lastSegmentMeasuresList =
       fVoiceLastSegment->getSegmentMeasuresList ();
       
@@ -21834,7 +21845,7 @@ S_msrElement msrVoice::fetchVoiceLastElement (
     lastMeasure =
       fetchVoiceLastMeasure (inputLineNumber);
 
-  const list<S_msrElement>&
+  const vector<S_msrElement>&
     lastMeasureElementsList =
       lastMeasure->getMeasureElementsList ();
       
@@ -21890,7 +21901,7 @@ void msrVoice::prepareForRepeatInVoice (
       if (fVoiceLastSegment) {
         
         // fetch last segment's measures list
-        list<S_msrMeasure>&
+        vector<S_msrMeasure>&
           voiceLastSegmentMeasuresList =
             fVoiceLastSegment->
               getSegmentMeasuresListToModify ();
@@ -22078,7 +22089,7 @@ void msrVoice::prepareForRepeatInVoiceClone (
       if (fVoiceLastSegment) {
         
         // fetch last segment's measures list
-        list<S_msrMeasure>&
+        vector<S_msrMeasure>&
           voiceLastSegmentMeasuresList =
             fVoiceLastSegment->
               getSegmentMeasuresListToModify ();
@@ -22458,7 +22469,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 #endif
           
           for (
-            list<S_msrElement>::iterator i = fVoiceInitialElementsList.begin ();
+            vector<S_msrElement>::iterator i = fVoiceInitialElementsList.begin ();
             i != fVoiceInitialElementsList.end ();
             i++) {
             S_msrElement element = (*i);
@@ -22507,7 +22518,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoice (
 #endif
           
           for (
-            list<S_msrElement>::iterator i = fVoiceInitialElementsList.begin ();
+            vector<S_msrElement>::iterator i = fVoiceInitialElementsList.begin ();
             i != fVoiceInitialElementsList.end ();
             i++) {
             S_msrElement element = (*i);
@@ -22749,7 +22760,7 @@ void msrVoice::createRepeatUponItsEndAndAppendItToVoiceClone (
 #endif
           
           for (
-            list<S_msrElement>::iterator i = fVoiceInitialElementsList.begin ();
+            vector<S_msrElement>::iterator i = fVoiceInitialElementsList.begin ();
             i != fVoiceInitialElementsList.end ();
             i++) {
             S_msrElement element = (*i);
@@ -23144,7 +23155,7 @@ void msrVoice::createEnclosingRepeatUponItsFirstEndingInVoice (
         gIndenter++;
         
         for (
-          list<S_msrElement>::const_iterator i = fVoiceInitialElementsList.begin ();
+          vector<S_msrElement>::const_iterator i = fVoiceInitialElementsList.begin ();
           i != fVoiceInitialElementsList.end ();
           i++) {
           repeatCommonPart->
@@ -23532,7 +23543,7 @@ void msrVoice::appendPendingMeasuresRepeatToVoice (
         }
 
         // fetch the last segment's measure list
-        list<S_msrMeasure>&
+        vector<S_msrMeasure>&
           voiceLastSegmentMeasureList =
             fVoiceLastSegment->
               getSegmentMeasuresListToModify ();
@@ -25108,13 +25119,13 @@ void msrVoice:: collectVoiceMeasuresIntoFlatList (
 
     list<S_msrMeasure> lastSegmentMeasuresFlatList;
 
-    const list<S_msrMeasure>&
+    const vector<S_msrMeasure>&
       voiceLastSegmentMeasuresList =
         fVoiceLastSegment->
           getSegmentMeasuresList ();
 
     if (voiceLastSegmentMeasuresList.size ()) {
-      list<S_msrMeasure>::const_iterator
+      vector<S_msrMeasure>::const_iterator
         iBegin = voiceLastSegmentMeasuresList.begin (),
         iEnd   = voiceLastSegmentMeasuresList.end (),
         i      = iBegin;
@@ -25220,7 +25231,7 @@ void msrVoice::browseData (basevisitor* v)
   // browse the voice initial elements
   if (fVoiceInitialElementsList.size ()) {
     for (
-      list<S_msrElement>::const_iterator i = fVoiceInitialElementsList.begin ();
+      vector<S_msrElement>::const_iterator i = fVoiceInitialElementsList.begin ();
       i != fVoiceInitialElementsList.end ();
       i++) {
       // browse the element
@@ -25501,7 +25512,7 @@ void msrVoice::print (ostream& os)
   if (voiceMeasuresFlatListSize) {
     gIndenter++;
 
-    list<S_msrMeasure>::const_iterator
+    vector<S_msrMeasure>::const_iterator
       iBegin = fVoiceMeasuresFlatList.begin (),
       iEnd   = fVoiceMeasuresFlatList.end (),
       i      = iBegin;
@@ -25541,7 +25552,7 @@ void msrVoice::print (ostream& os)
       
     gIndenter++;
 
-    list<S_msrElement>::const_iterator
+    vector<S_msrElement>::const_iterator
       iBegin = fVoiceInitialElementsList.begin (),
       iEnd   = fVoiceInitialElementsList.end (),
       i      = iBegin;
@@ -26314,6 +26325,10 @@ void msrStaff::registerVoiceByItsNumber (
   } // switch  
 }
 
+// the voice numbers beyond this one are looked up
+// by scanning fStaffRegularVoicesMap
+#define K_STAFF_MAX_INDEXED_VOICE_NUMBER 63
+
 void msrStaff::registerVoiceInRegularVoicesMap (
   int        voiceNumber,
   S_msrVoice voice)
@@ -26333,6 +26348,21 @@ void msrStaff::registerVoiceInRegularVoicesMap (
   fStaffRegularVoicesMap [fStaffRegularVoicesCounter] =
     voice;
 
+  // index it by its number, the first voice registered
+  // with a given number is the one that is fetched
+  if (
+    voiceNumber >= 0
+      &&
+    voiceNumber <= K_STAFF_MAX_INDEXED_VOICE_NUMBER) {
+    if (voiceNumber >= (int) fStaffRegularVoicesByNumber.size ()) {
+      fStaffRegularVoicesByNumber.resize (voiceNumber + 1);
+    }
+
+    if (! fStaffRegularVoicesByNumber [voiceNumber]) {
+      fStaffRegularVoicesByNumber [voiceNumber] = voice;
+    }
+  }
+
   // set voice staff sequential number
   voice->
     setRegularVoiceStaffSequentialNumber (
@@ -26376,6 +26406,32 @@ S_msrVoice msrStaff::fetchVoiceFromStaffByItsNumber (
   }
 #endif
 
+  // constant time lookup for the usual voice numbers
+  if (
+    voiceNumber >= 0
+      &&
+    voiceNumber <= K_STAFF_MAX_INDEXED_VOICE_NUMBER) {
+    if (voiceNumber < (int) fStaffRegularVoicesByNumber.size ()) {
+      result = fStaffRegularVoicesByNumber [voiceNumber];
+    }
+    
+#ifdef TRACE_OPTIONS
+    if (
+      result
+        &&
+      (gTraceOptions->fTraceVoices || gTraceOptions->fTraceStaves)) {
+      gLogIOstream <<
+        "Voice " << voiceNumber <<
+        " in staff \"" << getStaffName () << "\"" <<
+        " has staff relative number " <<
+        result->getRegularVoiceStaffSequentialNumber () <<
+        endl;
+    }
+#endif
+
+    return result;
+  }
+
   for (
     map<int, S_msrVoice>::const_iterator i =
       fStaffRegularVoicesMap.begin ();
@@ -28199,8 +28255,6 @@ ostream& operator<< (ostream& os, const S_msrVoiceStaffChange& elt)
 }
 
 //______________________________________________________________________________ 
-int msrPart::gPartsCounter = 0;
-
 S_msrPart msrPart::create (
   int            inputLineNumber,
   string         partID,
@@ -28235,7 +28289,8 @@ msrPart::msrPart (
     */
 
   // set part number
-  fPartAbsoluteNumber = ++gPartsCounter;
+  fPartAbsoluteNumber =
+    ++conversionContext::current ().fPartsCounter;
   
   // set part's part group uplink
   fPartPartGroupUplink = partPartGroupUplink;
@@ -29278,7 +29333,7 @@ S_msrStaff msrPart::addStaffToPartByItsNumber (
     case msrStaff::kFiguredBassStaff:
     case msrStaff::kDrumStaff:
     case msrStaff::kRythmicStaff:
-      fPartStavesMap [staffNumber] = staff;
+      registerStaffInPart (staff);
       break;
   } // switch
   
@@ -29311,16 +29366,50 @@ void msrPart::addStaffToPartCloneByItsNumber (S_msrStaff staff)
 #endif
 
   // register staff in this part
-  fPartStavesMap [staff->getStaffNumber ()] = staff;
+  registerStaffInPart (staff);
+}
+
+// the staff numbers beyond this one are only looked up in fPartStavesMap
+#define K_PART_MAX_INDEXED_STAFF_NUMBER 63
+
+void msrPart::registerStaffInPart (
+  S_msrStaff staff)
+{
+  int staffNumber = staff->getStaffNumber ();
+  
+  fPartStavesMap [staffNumber] = staff;
+
+  if (
+    staffNumber >= 0
+      &&
+    staffNumber <= K_PART_MAX_INDEXED_STAFF_NUMBER) {
+    if (staffNumber >= (int) fPartStavesByNumber.size ()) {
+      fPartStavesByNumber.resize (staffNumber + 1);
+    }
+    
+    fPartStavesByNumber [staffNumber] = staff;
+  }
 }
 
 S_msrStaff msrPart::fetchStaffFromPart (
   int staffNumber)
 {
+  // constant time lookup for the usual staff numbers
+  if (
+    staffNumber >= 0
+      &&
+    staffNumber < (int) fPartStavesByNumber.size ()) {
+    return fPartStavesByNumber [staffNumber];
+  }
+
   S_msrStaff result;
   
-  if (fPartStavesMap.count (staffNumber)) {
-    result = fPartStavesMap [staffNumber];
+  map<int, S_msrStaff>::const_iterator
+    it =
+      fPartStavesMap.find (staffNumber);
+        
+  if (it != fPartStavesMap.end ()) {
+    result = (*it).second;
   }
 
   return result;
@@ -13,6 +13,8 @@
 #ifndef ___msrMutuallyDependent___
 #define ___msrMutuallyDependent___
 
+#include <memory>
+
 #include "typedefs.h"
 #include "tree_browser.h"
 #include "exports.h"
@@ -818,7 +820,7 @@ class msrMeasure : public msrElement
 
     // elements list
     
-    const list<S_msrElement>&
+    const vector<S_msrElement>&
                           getMeasureElementsList () const
                               { return fMeasureElementsList; }
 
@@ -1154,7 +1156,7 @@ class msrMeasure : public msrElement
 
     // elements
 
-    list<S_msrElement>    fMeasureElementsList;
+    vector<S_msrElement>  fMeasureElementsList;
     
     bool                  fMeasureContainsMusic;
 };
@@ -1214,11 +1216,11 @@ class msrSegment : public msrElement
                       
     // measures
     
-    const list<S_msrMeasure>&
+    const vector<S_msrMeasure>&
                           getSegmentMeasuresList () const
                               { return fSegmentMeasuresList; }
                                             
-    list<S_msrMeasure>&   getSegmentMeasuresListToModify ()
+    vector<S_msrMeasure>& getSegmentMeasuresListToModify ()
                               { return fSegmentMeasuresList; }
                                             
     const string          getSegmentMeasureNumber () const
@@ -1497,9 +1499,6 @@ class msrSegment : public msrElement
     // uplinks
     S_msrVoice            fSegmentVoiceUplink;
 
-    // counter
-    static int            gSegmentsCounter;
-
     // absolute number
     int                   fSegmentAbsoluteNumber;
         
@@ -1508,7 +1507,7 @@ class msrSegment : public msrElement
     bool                  fMeasureNumberHasBeenSetInSegment; // JMI
 
     // the measures in the segment contain the mmusic
-    list<S_msrMeasure>    fSegmentMeasuresList;
+    vector<S_msrMeasure>  fSegmentMeasuresList;
 };
 typedef SMARTP<msrSegment> S_msrSegment;
 EXP ostream& operator<< (ostream& os, const S_msrSegment& elt);
@@ -1582,7 +1581,7 @@ class msrGraceNotesGroup : public msrElement
                             msrGraceNotesGroupKind graceNotesGroupKind)
                               { fGraceNotesGroupKind = graceNotesGroupKind; }
 
-    list<S_msrElement>&   getGraceNotesGroupElementsList ()
+    vector<S_msrElement>& getGraceNotesGroupElementsList ()
                               { return fGraceNotesGroupElementsList; }
 
     bool                  getGraceNotesGroupIsSlashed () const
@@ -1651,7 +1650,7 @@ class msrGraceNotesGroup : public msrElement
     msrGraceNotesGroupKind
                           fGraceNotesGroupKind;
                           
-    list<S_msrElement>    fGraceNotesGroupElementsList;
+    vector<S_msrElement>  fGraceNotesGroupElementsList;
 
     bool                  fGraceNotesGroupIsSlashed;
     bool                  fGraceNotesGroupIsTied;
@@ -2748,6 +2747,44 @@ class msrSlide : public msrElement
 typedef SMARTP<msrSlide> S_msrSlide;
 EXP ostream& operator<< (ostream& os, const S_msrSlide& elt);
 
+//______________________________________________________________________________
+/*
+  the note attachments:
+  most of them are absent for a typical note, they are kept
+  in a block that is allocated when a first one is added
+*/
+struct msrNoteAttachments
+{
+    list<S_msrSyllable>   fNoteSyllables;
+    list<S_msrBeam>       fNoteBeams;
+    list<S_msrArticulation>
+                          fNoteArticulations;
+    list<S_msrSpanner>    fNoteSpanners;
+    list<S_msrTechnical>  fNoteTechnicals;
+    list<S_msrTechnicalWithInteger>
+                          fNoteTechnicalWithIntegers;
+    list<S_msrTechnicalWithFloat>
+                          fNoteTechnicalWithFloats;
+    list<S_msrTechnicalWithString>
+                          fNoteTechnicalWithStrings;
+    list<S_msrOrnament>   fNoteOrnaments;
+    list<S_msrGlissando>  fNoteGlissandos;
+    list<S_msrSlide>      fNoteSlides;
+    list<S_msrDynamics>   fNoteDynamics;
+    list<S_msrOtherDynamics>
+                          fNoteOtherDynamics;
+    list<S_msrSlash>      fNoteSlashes;
+    list<S_msrWedge>      fNoteWedges;
+    list<S_msrEyeGlasses> fNoteEyeGlasses;
+    list<S_msrDamp>       fNoteDamps;
+    list<S_msrDampAll>    fNoteDampAlls;
+    list<S_msrScordatura> fNoteScordaturas;
+    list<S_msrWords>      fNoteWords;
+    list<S_msrSlur>       fNoteSlurs;
+    list<S_msrLigature>   fNoteLigatures;
+    list<S_msrPedal>      fNotePedals;
+};
+
 //______________________________________________________________________________
 class msrNote : public msrElement
 {
@@ -3186,12 +3223,19 @@ class msrNote : public msrElement
     // note lyrics
     // -------------------------------
 
-    list<S_msrSyllable>   getNoteSyllables () const
-                              { return fNoteSyllables; }              
+    const list<S_msrSyllable>&
+                          getNoteSyllables () const
+                              { return getNoteAttachments ().fNoteSyllables; }              
 
     // elements attached to the note
     // -------------------------------
 
+    // the attachments block, the const version never allocates it
+    const msrNoteAttachments&
+                          getNoteAttachments () const;
+
+    msrNoteAttachments&   getNoteAttachmentsToModify ();
+
     // stems
     void                  setNoteStem (S_msrStem stem);
 
@@ -3201,57 +3245,57 @@ class msrNote : public msrElement
     // beams
     const list<S_msrBeam>&
                           getNoteBeams () const
-                              { return fNoteBeams; }
+                              { return getNoteAttachments ().fNoteBeams; }
 
     // articulations
     const list<S_msrArticulation>&
                           getNoteArticulations () const
-                              { return fNoteArticulations; }
+                              { return getNoteAttachments ().fNoteArticulations; }
                       
     list<S_msrArticulation>&
                           getNoteArticulationsToModify ()
-                              { return fNoteArticulations; }
+                              { return getNoteAttachmentsToModify ().fNoteArticulations; }
 
     // spanners
     const list<S_msrSpanner>&
                           getNoteSpanners () const
-                              { return fNoteSpanners; }
+                              { return getNoteAttachments ().fNoteSpanners; }
                       
     list<S_msrSpanner>&
                           getNoteSpannersToModify ()
-                              { return fNoteSpanners; }
+                              { return getNoteAttachmentsToModify ().fNoteSpanners; }
 
     // technicals
     const list<S_msrTechnical>&
                           getNoteTechnicals () const
-                              { return fNoteTechnicals; }
+                              { return getNoteAttachments ().fNoteTechnicals; }
                               
     const list<S_msrTechnicalWithInteger>&
                           getNoteTechnicalWithIntegers () const
-                              { return fNoteTechnicalWithIntegers; }
+                              { return getNoteAttachments ().fNoteTechnicalWithIntegers; }
                               
     const list<S_msrTechnicalWithFloat>&
                           getNoteTechnicalWithFloats () const
-                              { return fNoteTechnicalWithFloats; }
+                              { return getNoteAttachments ().fNoteTechnicalWithFloats; }
                               
     const list<S_msrTechnicalWithString>&
                           getNoteTechnicalWithStrings () const
-                              { return fNoteTechnicalWithStrings; }
+                              { return getNoteAttachments ().fNoteTechnicalWithStrings; }
                               
     // ornaments
     const list<S_msrOrnament>&
                           getNoteOrnaments () const
-                              { return fNoteOrnaments; }
+                              { return getNoteAttachments ().fNoteOrnaments; }
         
     // glissandos
     const list<S_msrGlissando>&
                           getNoteGlissandos () const
-                              { return fNoteGlissandos; }
+                              { return getNoteAttachments ().fNoteGlissandos; }
         
     // slides
     const list<S_msrSlide>&
                           getNoteSlides () const
-                              { return fNoteSlides; }
+                              { return getNoteAttachments ().fNoteSlides; }
         
     // grace notes
     void                  setNoteGraceNotesGroupBefore (
@@ -3292,67 +3336,67 @@ class msrNote : public msrElement
     // dynamics
     const list<S_msrDynamics>&
                           getNoteDynamics () const
-                              { return fNoteDynamics; }
+                              { return getNoteAttachments ().fNoteDynamics; }
     const list<S_msrOtherDynamics>&
                           getNoteOtherDynamics () const
-                              { return fNoteOtherDynamics; }
+                              { return getNoteAttachments ().fNoteOtherDynamics; }
         
     // words
     const list<S_msrWords>&
                           getNoteWords () const
-                              { return fNoteWords; }
+                              { return getNoteAttachments ().fNoteWords; }
                       
     list<S_msrWords>&     getNoteWordsToModify ()
-                              { return fNoteWords; }
+                              { return getNoteAttachmentsToModify ().fNoteWords; }
                       
     // slashes
     const list<S_msrSlash>&
                           getNoteSlashes () const
-                              { return fNoteSlashes; }
+                              { return getNoteAttachments ().fNoteSlashes; }
 
     // wedges
     const list<S_msrWedge>&
                           getNoteWedges () const
-                              { return fNoteWedges; }
+                              { return getNoteAttachments ().fNoteWedges; }
 
     list<S_msrWedge>&
                           getNoteWedgesToModify ()
-                              { return fNoteWedges; }
+                              { return getNoteAttachmentsToModify ().fNoteWedges; }
 
     // eyeglasses
     const list<S_msrEyeGlasses>&
                           getNoteEyeGlasses () const
-                              { return fNoteEyeGlasses; }
+                              { return getNoteAttachments ().fNoteEyeGlasses; }
     
     // damps
     const list<S_msrDamp>&
                           getNoteDamps () const
-                              { return fNoteDamps; };
+                              { return getNoteAttachments ().fNoteDamps; };
     
     // damp alls
     const list<S_msrDampAll>&
                           getNoteDampAlls () const
-                              { return fNoteDampAlls; }
+                              { return getNoteAttachments ().fNoteDampAlls; }
     
     // scordaturas
     const list<S_msrScordatura>&
                           getNoteScordaturas () const
-                              { return fNoteScordaturas; }
+                              { return getNoteAttachments ().fNoteScordaturas; }
 
     // slurs
     const list<S_msrSlur>&
                           getNoteSlurs () const
-                              { return fNoteSlurs; }
+                              { return getNoteAttachments ().fNoteSlurs; }
 
     // ligatures
     const list<S_msrLigature>&
                           getNoteLigatures () const
-                              { return fNoteLigatures; }
+                              { return getNoteAttachments ().fNoteLigatures; }
 
     // pedals
     const list<S_msrPedal>&
                           getNotePedals () const
-                              { return fNotePedals; }
+                              { return getNoteAttachments ().fNotePedals; }
 
     // note measure information
     // -------------------------------
@@ -3663,61 +3707,19 @@ class msrNote : public msrElement
     bool                  fNoteBelongsToAMultipleRest; // JMI
     int                   fNoteMultipleRestSequenceNumber; // JMI
 
-    // note lyrics
+    // attachments
     // ------------------------------------------------------
 
-    list<S_msrSyllable>   fNoteSyllables;
-    
+    // null until a first attachment is added to the note,
+    // owned by the note (which is not copyable)
+    std::unique_ptr<msrNoteAttachments>
+                          fNoteAttachments;
+
     // stem
     // ------------------------------------------------------
 
     S_msrStem             fNoteStem;
 
-    // beams
-    // ------------------------------------------------------
-
-    list<S_msrBeam>       fNoteBeams;
-                                      
-    // articulations
-    // ------------------------------------------------------
-
-    list<S_msrArticulation>
-                          fNoteArticulations;
-
-    // spanners
-    // ------------------------------------------------------
-
-    list<S_msrSpanner>    fNoteSpanners;
-
-    // technicals
-    // ------------------------------------------------------
-
-    list<S_msrTechnical>  fNoteTechnicals;
-    
-    list<S_msrTechnicalWithInteger>
-                          fNoteTechnicalWithIntegers;
-                          
-    list<S_msrTechnicalWithFloat>
-                          fNoteTechnicalWithFloats;
-                          
-    list<S_msrTechnicalWithString>
-                          fNoteTechnicalWithStrings;
-
-    // ornaments
-    // ------------------------------------------------------
-
-    list<S_msrOrnament>   fNoteOrnaments;
-    
-    // glissandos
-    // ------------------------------------------------------
-
-    list<S_msrGlissando>  fNoteGlissandos;
-    
-    // slides
-    // ------------------------------------------------------
-
-    list<S_msrSlide>      fNoteSlides;
-    
     // grace notes
     // ------------------------------------------------------
 
@@ -3736,63 +3738,6 @@ class msrNote : public msrElement
 
     S_msrTie              fNoteTie;
     
-    // dynamics
-    // ------------------------------------------------------
-
-    list<S_msrDynamics>   fNoteDynamics;
-    list<S_msrOtherDynamics>
-                          fNoteOtherDynamics;
-                          
-    // slashes
-    // ------------------------------------------------------
-
-    list<S_msrSlash>      fNoteSlashes;
-
-    // wedges
-    // ------------------------------------------------------
-
-    list<S_msrWedge>      fNoteWedges;
-
-    // eyeglasses
-    // ------------------------------------------------------
-
-    list<S_msrEyeGlasses> fNoteEyeGlasses;
-    
-    // damps
-    // ------------------------------------------------------
-
-    list<S_msrDamp>       fNoteDamps;
-    
-    // damp alls
-    // ------------------------------------------------------
-
-    list<S_msrDampAll>    fNoteDampAlls;
-    
-    // scordaturas
-    // ------------------------------------------------------
-
-    list<S_msrScordatura> fNoteScordaturas;
-
-    // words
-    // ------------------------------------------------------
-
-    list<S_msrWords>      fNoteWords;
-
-    // slurs
-    // ------------------------------------------------------
-
-    list<S_msrSlur>       fNoteSlurs;
-
-    // ligatures
-    // ------------------------------------------------------
-
-    list<S_msrLigature>   fNoteLigatures;
-
-    // pedals
-    // ------------------------------------------------------
-
-    list<S_msrPedal>      fNotePedals;
-
     // harmony
     // ------------------------------------------------------
 
@@ -3850,6 +3795,41 @@ class msrNote : public msrElement
 typedef SMARTP<msrNote> S_msrNote;
 EXP ostream& operator<< (ostream& os, const S_msrNote& elt);
 
+//______________________________________________________________________________
+/*
+  the chord attachments:
+  like the notes ones, they are kept in a block
+  that is allocated when a first one is added
+*/
+struct msrChordAttachments
+{
+    list<S_msrStem>       fChordStems;
+    list<S_msrBeam>       fChordBeams;
+    list<S_msrArticulation>
+                          fChordArticulations;
+    list<S_msrSpanner>    fChordSpanners;
+    list<S_msrTechnical>  fChordTechnicals;
+    list<S_msrTechnicalWithInteger>
+                          fChordTechnicalWithIntegers;
+    list<S_msrTechnicalWithFloat>
+                          fChordTechnicalWithFloats;
+    list<S_msrTechnicalWithString>
+                          fChordTechnicalWithStrings;
+    list<S_msrOrnament>   fChordOrnaments;
+    list<S_msrGlissando>  fChordGlissandos;
+    list<S_msrSlide>      fChordSlides;
+    list<S_msrDynamics>   fChordDynamics;
+    list<S_msrOtherDynamics>
+                          fChordOtherDynamics;
+    list<S_msrSlash>      fChordSlashes;
+    list<S_msrWedge>      fChordWedges;
+    list<S_msrWords>      fChordWords;
+    list<S_msrTie>        fChordTies;
+    list<S_msrSlur>       fChordSlurs;
+    list<S_msrLigature>   fChordLigatures;
+    list<S_msrPedal>      fChordPedals;
+};
+
 //______________________________________________________________________________
 class msrChord : public msrElement
 {
@@ -3910,57 +3890,63 @@ class msrChord : public msrElement
                           getChordNotesVector () const
                               { return fChordNotesVector; }
 
+    // the attachments block, the const version never allocates it
+    const msrChordAttachments&
+                          getChordAttachments () const;
+
+    msrChordAttachments&  getChordAttachmentsToModify ();
+
     // stems
     const list<S_msrStem>&
                           getChordStems () const
-                              { return fChordStems; }
+                              { return getChordAttachments ().fChordStems; }
 
     // beams
     const list<S_msrBeam>&
                           getChordBeams () const
-                              { return fChordBeams; }
+                              { return getChordAttachments ().fChordBeams; }
 
     // articulations
     const list<S_msrArticulation>&
                           getChordArticulations () const
-                              { return fChordArticulations; }
+                              { return getChordAttachments ().fChordArticulations; }
 
     // spanners
     const list<S_msrSpanner>&
                           getChordSpanners () const
-                              { return fChordSpanners; }
+                              { return getChordAttachments ().fChordSpanners; }
 
     // technicals
     const list<S_msrTechnical>&
                           getChordTechnicals () const
-                              { return fChordTechnicals; }
+                              { return getChordAttachments ().fChordTechnicals; }
                               
     const list<S_msrTechnicalWithInteger>&
                           getChordTechnicalWithIntegers () const
-                              { return fChordTechnicalWithIntegers; }
+                              { return getChordAttachments ().fChordTechnicalWithIntegers; }
     
     const list<S_msrTechnicalWithFloat>&
                           getChordTechnicalWithFloats () const
-                              { return fChordTechnicalWithFloats; }
+                              { return getChordAttachments ().fChordTechnicalWithFloats; }
     
     const list<S_msrTechnicalWithString>&
                           getChordTechnicalWithStrings () const
-                              { return fChordTechnicalWithStrings; }
+                              { return getChordAttachments ().fChordTechnicalWithStrings; }
     
     // ornaments
     const list<S_msrOrnament>&
                           getChordOrnaments () const
-                              { return fChordOrnaments; }
+                              { return getChordAttachments ().fChordOrnaments; }
     
     // glissandos
     const list<S_msrGlissando>&
                           getChordGlissandos () const
-                              { return fChordGlissandos; }
+                              { return getChordAttachments ().fChordGlissandos; }
     
     // slides
     const list<S_msrSlide>&
                           getChordSlides () const
-                              { return fChordSlides; }
+                              { return getChordAttachments ().fChordSlides; }
     
     // singleTremolo
     void                  setChordSingleTremolo (
@@ -3972,39 +3958,39 @@ class msrChord : public msrElement
     // dynamics
     const list<S_msrDynamics>&
                           getChordDynamics () const
-                              { return fChordDynamics; }
+                              { return getChordAttachments ().fChordDynamics; }
     const list<S_msrOtherDynamics>&
                           getChordOtherDynamics () const
-                              { return fChordOtherDynamics; }
+                              { return getChordAttachments ().fChordOtherDynamics; }
                       
     const list<S_msrWedge>&
                           getChordWedges () const
-                              { return fChordWedges; }
+                              { return getChordAttachments ().fChordWedges; }
 
     // words
     const list<S_msrWords>&
                           getChordWords () const
-                              { return fChordWords; }
+                              { return getChordAttachments ().fChordWords; }
                       
     // ties
     const list<S_msrTie>&
                           getChordTies () const
-                              { return fChordTies; }
+                              { return getChordAttachments ().fChordTies; }
                       
     // slurs
     const list<S_msrSlur>&
                           getChordSlurs () const
-                              { return fChordSlurs; }
+                              { return getChordAttachments ().fChordSlurs; }
                       
     // ligatures
     const list<S_msrLigature>&
                           getChordLigatures () const
-                              { return fChordLigatures; }
+                              { return getChordAttachments ().fChordLigatures; }
                       
     // pedals
     const list<S_msrPedal>&
                           getChordPedals () const
-                              { return fChordPedals; }
+                              { return getChordAttachments ().fChordPedals; }
                       
     // double tremolo
     void                  setChordIsFirstChordInADoubleTremolo ()
@@ -4134,48 +4120,48 @@ class msrChord : public msrElement
     // dynamics
     void                  appendDynamicsToChord (S_msrDynamics dynamic)
                               {
-                                fChordDynamics.push_back (dynamic);
+                                getChordAttachmentsToModify ().fChordDynamics.push_back (dynamic);
                               }
     void                  appendOtherDynamicsToChord (
                             S_msrOtherDynamics otherDynamic)
                               {
-                                fChordOtherDynamics.push_back (otherDynamic);
+                                getChordAttachmentsToModify ().fChordOtherDynamics.push_back (otherDynamic);
                               }
 
     // slashes
     void                  appendSlashToChord (S_msrSlash slash)
                               {
-                                fChordSlashes.push_back (slash);
+                                getChordAttachmentsToModify ().fChordSlashes.push_back (slash);
                               }
 
     // wedges
     void                  appendWedgeToChord (S_msrWedge wedge)
                               {
-                                fChordWedges.push_back (wedge);
+                                getChordAttachmentsToModify ().fChordWedges.push_back (wedge);
                               }
                                         
     // words
     void                  appendWordsToChord (S_msrWords dynamic)
                               {
-                                fChordWords.push_back (dynamic);
+                                getChordAttachmentsToModify ().fChordWords.push_back (dynamic);
                               }
                     
     // ties
     void                  appendTieToChord (S_msrTie tie)
                               {
-                                fChordTies.push_back (tie);
+                                getChordAttachmentsToModify ().fChordTies.push_back (tie);
                               }
                       
     // slurs
     void                  appendSlurToChord (S_msrSlur slur)
                               {
-                                fChordSlurs.push_back (slur);
+                                getChordAttachmentsToModify ().fChordSlurs.push_back (slur);
                               }
                       
     // stems
     void                  appendStemToChord (S_msrStem stem)
                               {
-                                fChordStems.push_back (stem);
+                                getChordAttachmentsToModify ().fChordStems.push_back (stem);
                               }
 
     // beams
@@ -4184,13 +4170,13 @@ class msrChord : public msrElement
     // ligatures
     void                  appendLigatureToChord (S_msrLigature ligature)
                               {
-                                fChordLigatures.push_back (ligature);
+                                getChordAttachmentsToModify ().fChordLigatures.push_back (ligature);
                               }
                       
     // pedals
     void                  appendPedalToChord (S_msrPedal pedal)
                               {
-                                fChordPedals.push_back (pedal);
+                                getChordAttachmentsToModify ().fChordPedals.push_back (pedal);
                               }
                       
     // tuplet members
@@ -4254,18 +4240,11 @@ class msrChord : public msrElement
     string                fChordMeasureNumber;
     rational              fChordPositionInMeasure;
 
-    // stems
-    list<S_msrStem>       fChordStems;
-    
-    // beams
-    list<S_msrBeam>       fChordBeams;
-    
-    // articulations
-    list<S_msrArticulation>
-                          fChordArticulations;
-
-    // spanners
-    list<S_msrSpanner>    fChordSpanners;
+    // attachments
+    // null until a first attachment is added to the chord,
+    // owned by the chord (which is not copyable)
+    std::unique_ptr<msrChordAttachments>
+                          fChordAttachments;
 
     // single tremolo
     S_msrSingleTremolo    fChordSingleTremolo;
@@ -4274,56 +4253,9 @@ class msrChord : public msrElement
     bool                  fChordIsFirstChordInADoubleTremolo;
     bool                  fChordIsSecondChordInADoubleTremolo;
 
-    // technicals
-    list<S_msrTechnical>  fChordTechnicals;
-    
-    list<S_msrTechnicalWithInteger>
-                          fChordTechnicalWithIntegers;
-    
-    list<S_msrTechnicalWithFloat>
-                          fChordTechnicalWithFloats;
-    
-    list<S_msrTechnicalWithString>
-                          fChordTechnicalWithStrings;
-    
-    // ornaments
-    list<S_msrOrnament>   fChordOrnaments;
-
-    // glissandos
-    list<S_msrGlissando>  fChordGlissandos;
-
-    // slides
-    list<S_msrSlide>      fChordSlides;
-    
     // ties
     S_msrTie              fChordTie;
     
-    // dynamics
-    list<S_msrDynamics>   fChordDynamics;
-    list<S_msrOtherDynamics>
-                          fChordOtherDynamics;
-
-    // slashes
-    list<S_msrSlash>      fChordSlashes;
-    
-    // wedges
-    list<S_msrWedge>      fChordWedges;
-    
-    // words
-    list<S_msrWords>      fChordWords;
-    
-    // ties
-    list<S_msrTie>        fChordTies;
-
-    // slurs
-    list<S_msrSlur>       fChordSlurs;
-
-    // ligatures
-    list<S_msrLigature>   fChordLigatures;
-
-    // pedals
-    list<S_msrPedal>      fChordPedals;
-
     // grace notes
     S_msrGraceNotesGroup  fChordGraceNotesGroupBefore;
     S_msrGraceNotesGroup  fChordGraceNotesGroupAfter;
@@ -4463,7 +4395,7 @@ class msrTuplet : public msrElement
     rational              getMemberNotesDisplayWholeNotes () const
                               { return fMemberNotesDisplayWholeNotes; }
 
-    const list<S_msrElement>&
+    const vector<S_msrElement>&
                           getTupletElementsList () const
                               { return fTupletElementsList; }
 
@@ -4578,7 +4510,7 @@ class msrTuplet : public msrElement
     string                fTupletMeasureNumber;
     rational              fTupletPositionInMeasure;
     
-    list<S_msrElement>    fTupletElementsList;
+    vector<S_msrElement>  fTupletElementsList;
 };
 typedef SMARTP<msrTuplet> S_msrTuplet;
 EXP ostream& operator<< (ostream& os, const S_msrTuplet& elt);
@@ -5915,7 +5847,7 @@ class msrVoice : public msrElement
                               { return fVoiceContainsMultipleRests; }
 
     // measures flat list
-    const list<S_msrMeasure>&
+    const vector<S_msrMeasure>&
                           getVoiceMeasuresFlatList () const
                               { return fVoiceMeasuresFlatList; }
 
@@ -6363,8 +6295,6 @@ class msrVoice : public msrElement
     S_msrVoice            fRegularVoiceForHarmonyVoice;
 
     // counters
-    
-    static int            gVoicesCounter;
 
     int                   fVoiceActualNotesCounter;
     int                   fVoiceRestsCounter;
@@ -6382,7 +6312,7 @@ class msrVoice : public msrElement
 
     // voice internal handling
     
-    list<S_msrElement>    fVoiceInitialElementsList;
+    vector<S_msrElement>  fVoiceInitialElementsList;
 
     // fVoiceLastSegment contains the music
     // not yet stored in fVoiceInitialElementsList,
@@ -6438,7 +6368,7 @@ class msrVoice : public msrElement
     // i.e. without segments nor repeats,
     // extracted from fVoiceInitialElementsList and fSaveVoiceLastSegment
     // by finalizeMeasure()
-    list<S_msrMeasure>    fVoiceMeasuresFlatList;
+    vector<S_msrMeasure>  fVoiceMeasuresFlatList;
 };
 EXP ostream& operator<< (ostream& os, const S_msrVoice& elt);
 
@@ -6835,6 +6765,10 @@ class msrStaff : public msrElement
     int                   fStaffRegularVoicesCounter;
     map<int, S_msrVoice>  fStaffRegularVoicesMap;
 
+    // the regular voices indexed by their number,
+    // for constant time lookup in fetchVoiceFromStaffByItsNumber ()
+    vector<S_msrVoice>    fStaffRegularVoicesByNumber;
+
     // we need to sort the voices by increasing voice numbers,
     // but with harmony voices right before the corresponding regular voices
     list<S_msrVoice>      fStaffAllVoicesList;
@@ -7378,6 +7312,15 @@ class msrPart : public msrElement
 
     virtual void          printSummary (ostream& os);
 
+  private:
+
+    // private services
+    // ------------------------------------------------------
+
+    // register staff in fPartStavesMap and fPartStavesByNumber
+    void                  registerStaffInPart (
+                            S_msrStaff staff);
+
   private:
 
     // fields
@@ -7444,9 +7387,9 @@ class msrPart : public msrElement
     
     map<int, S_msrStaff>  fPartStavesMap;
 
-    // counter
-    
-    static int            gPartsCounter;
+    // the same staves indexed by their number,
+    // for constant time lookup in fetchStaffFromPart ()
+    vector<S_msrStaff>    fPartStavesByNumber;
 };
 typedef SMARTP<msrPart> S_msrPart;
 EXP ostream& operator<< (ostream& os, const S_msrPart& elt);
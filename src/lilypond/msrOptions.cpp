@@ -254,10 +254,6 @@ ostream& operator<< (ostream& os, const S_optionsMsrPitchesLanguageItem& elt)
 }
 
 //_______________________________________________________________________________
-S_msrOptions gMsrOptions;
-S_msrOptions gMsrOptionsUserChoices;
-S_msrOptions gMsrOptionsWithDetailedTrace;
-
 S_msrOptions msrOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -319,9 +319,10 @@ class msrOptions : public optionsGroup
 typedef SMARTP<msrOptions> S_msrOptions;
 EXP ostream& operator<< (ostream& os, const S_msrOptions& elt);
 
-EXP extern S_msrOptions gMsrOptions;
-EXP extern S_msrOptions gMsrOptionsUserChoices;
-EXP extern S_msrOptions gMsrOptionsWithDetailedTrace;
+// the options of the current conversion context
+#define gMsrOptions                  (conversionContext::current ().fMsrOptions)
+#define gMsrOptionsUserChoices       (conversionContext::current ().fMsrOptionsUserChoices)
+#define gMsrOptionsWithDetailedTrace (conversionContext::current ().fMsrOptionsWithDetailedTrace)
 
 //______________________________________________________________________________
 void initializeMsrOptionsHandling (
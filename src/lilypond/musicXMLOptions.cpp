@@ -25,9 +25,6 @@ namespace MusicXML2
 
 //_______________________________________________________________________________
 
-S_musicXMLOptions gMusicXMLOptions;
-S_musicXMLOptions gMusicXMLOptionsUserChoices;
-S_musicXMLOptions gMusicXMLOptionsWithDetailedTrace;
 
 S_musicXMLOptions musicXMLOptions::create (
   S_optionsHandler optionsHandler)
@@ -118,9 +118,10 @@ class musicXMLOptions : public optionsGroup
 typedef SMARTP<musicXMLOptions> S_musicXMLOptions;
 EXP ostream& operator<< (ostream& os, const S_musicXMLOptions& elt);
 
-EXP extern S_musicXMLOptions gMusicXMLOptions;
-EXP extern S_musicXMLOptions gMusicXMLOptionsUserChoices;
-EXP extern S_musicXMLOptions gMusicXMLOptionsWithDetailedTrace;
+// the options of the current conversion context
+#define gMusicXMLOptions                  (conversionContext::current ().fMusicXMLOptions)
+#define gMusicXMLOptionsUserChoices       (conversionContext::current ().fMusicXMLOptionsUserChoices)
+#define gMusicXMLOptionsWithDetailedTrace (conversionContext::current ().fMusicXMLOptionsWithDetailedTrace)
 
 //______________________________________________________________________________
 void initializeMusicXMLOptionsHandling (
@@ -207,13 +207,89 @@ mxmlTree2MsrSkeletonBuilder::mxmlTree2MsrSkeletonBuilder (
 mxmlTree2MsrSkeletonBuilder::~mxmlTree2MsrSkeletonBuilder ()
 {}
 
+//________________________________________________________________________
+/*
+  The skeleton only needs the part-list and the parts, staves and voices
+  structure: the subtrees below don't contain any of the elements visited
+  by mxmlTree2MsrSkeletonBuilder, they're not browsed at all.
+  The elements that may contain <staff/>, <voice/>, <lyric/>, <harmony/>,
+  <figured-bass/>, <display-text/> or <print/> contents must be browsed.
+*/
+static bool mxmlSubTreeIsNeededBySkeleton (int elementType)
+{
+  switch (elementType) {
+    // note contents
+    case k_pitch:
+    case k_unpitched:
+    case k_rest:
+    case k_duration:
+    case k_tie:
+    case k_type:
+    case k_dot:
+    case k_accidental:
+    case k_time_modification:
+    case k_stem:
+    case k_notehead:
+    case k_beam:
+    case k_notations:
+    case k_grace:
+    case k_cue:
+    case k_chord:
+    case k_play:
+    case k_instrument:
+
+    // measure contents
+    case k_direction_type:
+    case k_barline:
+    case k_backup:
+    case k_sound:
+
+    // attributes contents
+    case k_key:
+    case k_time:
+    case k_clef:
+    case k_transpose:
+    case k_staff_details:
+    case k_measure_style:
+      return false;
+
+    default:
+      return true;
+  } // switch
+}
+
+class mxmlSkeletonTreeBrowser : public tree_browser<xmlelement>
+{
+  public:
+
+    mxmlSkeletonTreeBrowser (basevisitor* v)
+      : tree_browser<xmlelement> (v)
+        {}
+
+    virtual void browse (xmlelement& t)
+        {
+          enter (t);
+
+          ctree<xmlelement>::literator iter;
+
+          for (iter = t.lbegin (); iter != t.lend (); iter++) {
+            if (mxmlSubTreeIsNeededBySkeleton ((*iter)->getType ())) {
+              browse (**iter);
+            }
+          } // for
+
+          leave (t);
+        }
+};
+
 //________________________________________________________________________
 void mxmlTree2MsrSkeletonBuilder::browseMxmlTree (
   const Sxmlelement& mxmlTree)
 {  
   if (mxmlTree) {
-    // create a tree browser on this visitor
-    tree_browser<xmlelement> browser (this);
+    // create a tree browser on this visitor,
+    // skipping the subtrees the skeleton doesn't need
+    mxmlSkeletonTreeBrowser browser (this);
     
     // browse the xmlelement tree
     browser.browse (*mxmlTree);
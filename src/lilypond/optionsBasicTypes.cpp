@@ -2951,40 +2951,37 @@ void optionsHandler::registerOptionsNamesInHandler (
     exit (33);
   }
   
-  for (
-    map<string, S_optionsElement>::iterator i =
-      fOptionsElementsMap.begin ();
-    i != fOptionsElementsMap.end ();
-    i++) {
+  // is optionLongName already in the options names map?
+  if (
+    optionLongNameSize
+      &&
+    fOptionsElementsMap.count (optionLongName)) {
+    stringstream s;
+
+    s <<
+      "option long name '" << optionLongName << "'" <<
+        " for option short name '" << optionShortName << "'" <<
+      " is specified more that once";
       
-    // is optionLongName already in the options names map?
-    if ((*i).first == optionLongName) {
-      stringstream s;
-  
-      s <<
-        "option long name '" << optionLongName << "'" <<
-          " for option short name '" << optionShortName << "'" <<
-        " is specified more that once";
-        
-      optionError (s.str ());
-      exit (33);
-    }
+    optionError (s.str ());
+    exit (33);
+  }
 
-    // is optionShortName already in the options names map?
-    if ((*i).first == optionShortName) {
-      if (optionShortName.size ()) {
-        stringstream s;
-    
-        s <<
-          "option short name '" << optionShortName << "'" <<
-          " for option long name '" << optionLongName << "'" <<
-          " is specified more that once";
-          
-        optionError (s.str ());
-        exit (33);
-      }
-    }
-  } // for
+  // is optionShortName already in the options names map?
+  if (
+    optionShortNameSize
+      &&
+    fOptionsElementsMap.count (optionShortName)) {
+    stringstream s;
+
+    s <<
+      "option short name '" << optionShortName << "'" <<
+      " for option long name '" << optionLongName << "'" <<
+      " is specified more that once";
+      
+    optionError (s.str ());
+    exit (33);
+  }
     
   // register optionsElement's names size
   if (optionLongNameSize) {
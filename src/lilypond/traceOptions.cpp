@@ -23,10 +23,6 @@ namespace MusicXML2
 {
 
 //_______________________________________________________________________________
-S_traceOptions gTraceOptions;
-S_traceOptions gTraceOptionsUserChoices;
-S_traceOptions gTraceOptionsWithDetailedTrace;
-
 S_traceOptions traceOptions::create (
   S_optionsHandler optionsHandler)
 {
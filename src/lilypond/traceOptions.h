@@ -276,9 +276,10 @@ class traceOptions : public optionsGroup
 typedef SMARTP<traceOptions> S_traceOptions;
 EXP ostream& operator<< (ostream& os, const S_traceOptions& elt);
 
-EXP extern S_traceOptions gTraceOptions;
-EXP extern S_traceOptions gTraceOptionsUserChoices;
-EXP extern S_traceOptions gTraceOptionsWithDetailedTrace;
+// the options of the current conversion context
+#define gTraceOptions                  (conversionContext::current ().fTraceOptions)
+#define gTraceOptionsUserChoices       (conversionContext::current ().fTraceOptionsUserChoices)
+#define gTraceOptionsWithDetailedTrace (conversionContext::current ().fTraceOptionsWithDetailedTrace)
 
 //______________________________________________________________________________
 void initializeTraceOptionsHandling (
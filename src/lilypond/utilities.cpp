@@ -186,8 +186,6 @@ void timing::print (ostream& os) const
     endl;
 }
 
-timing timing::gTiming;
-
 //______________________________________________________________________________
 //#define DEBUG_INDENTER
 
@@ -323,42 +321,43 @@ void indenter::print (ostream& os) const
   while (i-- > 0) os << fSpacer;
 }
 
-indenter indenter::gIndenter;
-
 //______________________________________________________________________________
-indentedOstream indentedOstream::gOutputIndentedOstream (
-  cout, indenter::gIndenter);
+indentedOstream::indentedStreamBuf::int_type
+  indentedOstream::indentedStreamBuf::overflow (int_type c)
+{
+  // move the put area contents to the pending text
+  fPendingText.append (pbase (), pptr () - pbase ());
+  setp (fPutArea, fPutArea + sizeof (fPutArea));
 
-indentedOstream indentedOstream::gLogIndentedOstream (
-  cerr, indenter::gIndenter);
+  if (! traits_type::eq_int_type (c, traits_type::eof ()))
+    fPendingText.push_back (traits_type::to_char_type (c));
 
-// code taken from:
-// http://comp.lang.cpp.moderated.narkive.com/fylLGJgp/redirect-output-to-dev-null
-template<typename Ch, typename Traits = std::char_traits<Ch> >
-struct basic_nullbuf : std::basic_streambuf<Ch, Traits>
+  return traits_type::not_eof (c);
+}
+
+int indentedOstream::indentedStreamBuf::sync ()
 {
-  typedef std::basic_streambuf<Ch, Traits> base_type;
-  typedef typename base_type::int_type int_type;
-  typedef typename base_type::traits_type traits_type;
-  
-  virtual int_type overflow (int_type c) {
-    return traits_type::not_eof (c);
-  }
-};
+  // the indentation is the current one, as when the line is ended
+  string spacer = fIndenter.getSpacer ();
+
+  fIndentedText.clear ();
 
-// convenient typedefs
-typedef basic_nullbuf <char>    nullbuf;
-//typedef basic_nullbuf <wchar_t> wnullbuf;
+  for (int i = fIndenter.getIndent (); i > 0; i--)
+    fIndentedText += spacer;
 
-// buffers and streams
-nullbuf cnull_obj;
-//wnullbuf wcnull_obj;
+  fIndentedText.append (fPendingText);
+  fIndentedText.append (pbase (), pptr () - pbase ());
 
-std::ostream cnull  (& cnull_obj);
-//std::wostream wcnull (& wcnull_obj);
+  fPendingText.clear ();
+  setp (fPutArea, fPutArea + sizeof (fPutArea));
 
-indentedOstream indentedOstream::gNullIndentedOstream (
-  cnull, indenter::gIndenter);
+  // a single write, fOutput is not flushed
+  fOutput.write (
+    fIndentedText.data (),
+    fIndentedText.size ());
+
+  return 0;
+}
 
 //______________________________________________________________________________
 string replicateString (
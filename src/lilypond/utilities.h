@@ -78,9 +78,6 @@ class EXP timing {
        timing ();
     virtual ~timing ();
 
-    // global variable for general use
-    static timing gTiming; 
-
     // add an item
     void                  appendTimingItem (
                             std::string    activity,
@@ -100,6 +97,9 @@ class EXP timing {
 };
 std::ostream& operator<< (std::ostream& os, const timing& tim);
 
+// the timing of the current conversion
+#define gTiming (conversionContext::current ().fTiming)
+
 //______________________________________________________________________________
 class EXP indenter
 {
@@ -138,9 +138,6 @@ class EXP indenter
 
     // indent a multiline 'R"(...)"' std::string
     std::string                indentMultiLineString (std::string value);
-    
-    // global variable for general use
-    static indenter       gIndenter; 
 
   private:
     int                   fIndent;
@@ -149,9 +146,9 @@ class EXP indenter
 
 EXP std::ostream& operator<< (std::ostream& os, const indenter& idtr);
 
-// useful shortcut macros
-#define gIndenter indenter::gIndenter
-#define gTab      indenter::gIndenter.getSpacer ()
+// useful shortcut macros, referring to the current conversion context
+#define gIndenter (conversionContext::current ().fIndenter)
+#define gTab      gIndenter.getSpacer ()
 
 //______________________________________________________________________________
 class EXP indentedOstream: public std::ostream
@@ -171,13 +168,21 @@ Usage:
  
   // a stream buffer that prefixes each line
   // with the current indentation
-  class indentedStreamBuf: public std::stringbuf
+  class indentedStreamBuf: public std::streambuf
   {
     private:
     
       std::ostream& fOutput;
       indenter&     fIndenter;
 
+      // the text written since the last sync,
+      // the put area holds its last characters
+      std::string   fPendingText;
+      char          fPutArea [256];
+
+      // the indentation followed by the pending text
+      std::string   fIndentedText;
+
     public:
     
       // constructor
@@ -186,25 +191,26 @@ Usage:
         indenter&     idtr)
         : fOutput (str),
           fIndenter (idtr)
-          {}
+          {
+            setp (fPutArea, fPutArea + sizeof (fPutArea));
+          }
 
-      // flush
+      // flush the actual output stream we are using
       void flush ()
           {
             fOutput.flush ();
           }
+
+    protected:
+    
+      // the put area is full
+      virtual int_type overflow (int_type c);
     
       // When we sync the stream with fOutput:
-      // 1) output the indentation then the buffer
-      // 2) reset the buffer
-      // 3) flush the actual output stream we are using.
-      virtual int sync ()
-          {
-            fOutput << fIndenter << str ();
-            str ("");
-            fOutput.flush ();
-            return 0;
-          }
+      // 1) write the indentation then the pending text in one go
+      // 2) reset the pending text
+      // fOutput is not flushed, it is buffered as it sees fit
+      virtual int sync ();
   };
 
   private:
@@ -226,25 +232,18 @@ Usage:
     virtual ~indentedOstream ()
         {};
 
-    // flush
+    // flush, including the actual output stream
     void flush ()
         {
+          fIndentedStreamBuf.pubsync ();
           fIndentedStreamBuf.flush ();
         }
-    
-    // global variables for general use
-    static indentedOstream
-                          gOutputIndentedOstream; 
-    static indentedOstream
-                          gLogIndentedOstream; 
-    static indentedOstream
-                          gNullIndentedOstream; 
 };
 
-// useful shortcut macros
-#define gOutputIOstream indentedOstream::gOutputIndentedOstream
-#define gLogIOstream    indentedOstream::gLogIndentedOstream
-#define gNullIOstream   indentedOstream::gNullIndentedOstream
+// useful shortcut macros, referring to the current conversion context
+#define gOutputIOstream (conversionContext::current ().fOutputIOstream)
+#define gLogIOstream    (conversionContext::current ().fLogIOstream)
+#define gNullIOstream   (conversionContext::current ().fNullIOstream)
 
 //______________________________________________________________________________
 struct stringQuoteEscaper
@@ -561,4 +560,7 @@ typedef SMARTP<OFdnStreambuf> S_OFdnStreambuf;
 } // namespace MusicXML2
 
 
+// the conversion context, needed by the macros above
+#include "conversionContext.h"
+
 #endif
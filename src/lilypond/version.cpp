@@ -42,18 +42,18 @@ versionInfo::~versionInfo ()
 void versionInfo::print (ostream& os) const
 {
   os << left <<
-    indenter::gIndenter <<
+    gIndenter <<
       setw (5) << fVersionNumber << " " <<
       "(" << fVersionDate << "):" <<
       endl <<
     
-  indenter::gIndenter++;
+  gIndenter++;
 
   os <<
-    indenter::gIndenter <<
+    gIndenter <<
       fVersionDescription;
 
-  indenter::gIndenter--;  
+  gIndenter--;  
 }
 
 void enlistVersion (
@@ -74,7 +74,7 @@ void printVersionsHistory (ostream& os)
     "Versions history:" <<
     endl << endl;
 
-  indenter::gIndenter++;
+  gIndenter++;
 
   list<versionInfo>::const_iterator
     iBegin = gVersionInfoList.begin (),
@@ -89,7 +89,7 @@ void printVersionsHistory (ostream& os)
   os <<
     endl << endl;
 
-  indenter::gIndenter--;
+  gIndenter--;
 }
 
 string currentVersionNumber ()
@@ -651,8 +651,6 @@ ostream& operator<< (ostream& os, const S_xml2lyOptionsHandler& elt)
 }
 
 //_______________________________________________________________________________
-S_xml2lyOptions gXml2lyOptions;
-
 S_xml2lyOptions xml2lyOptions::create (
   S_optionsHandler optionsHandler)
 {
@@ -304,7 +304,8 @@ class xml2lyOptions : public optionsGroup
 typedef SMARTP<xml2lyOptions> S_xml2lyOptions;
 EXP ostream& operator<< (ostream& os, const S_xml2lyOptions& elt);
 
-EXP extern S_xml2lyOptions gXml2lyOptions;
+// the options of the current conversion context
+#define gXml2lyOptions (conversionContext::current ().fXml2lyOptions)
 
 //______________________________________________________________________________
 void initializeXml2lyOptionsHandling (
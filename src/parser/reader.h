@@ -15,9 +15,14 @@
 
 class reader
 { 
+	int		fInputLineNumber;		// the current input line number, maintained by the parser
+
 	public:
-				 reader() {}
+				 reader() : fInputLineNumber(0) {}
 		virtual ~reader() {};
+
+		int		getInputLineNumber () const		{ return fInputLineNumber; }
+		void	setInputLineNumber (int line)	{ fInputLineNumber = line; }
 		
 		virtual bool	xmlDecl (const char* version, const char *encoding, int standalone) = 0;
 		virtual bool	docType (const char* start, bool status, const char *pub, const char *sys) = 0;
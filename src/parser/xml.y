@@ -6,68 +6,65 @@
   grammar as defined in 
   "XML in a nutshell - 2nd edition" E.R.Harold and W.S.Means,
   O'Reilly, June 2002, pp:366--371
+
+  The parser is reentrant: all the parsing state is kept in a parsestate
+  structure allocated for each parse, and the scanner is a reentrant flex
+  scanner carrying this structure as extra data. Several documents can
+  thus be parsed concurrently, provided each one uses its own reader.
 */
 
 
 #include <stdio.h>
 #include <string.h>
+#include <string>
 #include <iostream>
 #include "reader.h"
 
+//______________________________________________________________________________
+// the state of a single parse
+struct parsestate {
+	reader *	fReader;
+
+	std::string	fAttributeName;
+	std::string	fAttributeVal;
+
+	std::string	fXmlVersion;
+	std::string	fXmlEncoding;
+	int			fXmlStandalone;
+
+	std::string	fEltName;
+	std::string	fDoctypeStart;
+	std::string	fDoctypePub;
+	std::string	fDoctypeSys;
+
+	// utf16 detection, used by the scanner input functions
+	int			fUtf16;
+	int			fBigEndian;
+	int			fStart;
+
+	parsestate (reader * r) : fReader(r), fXmlStandalone(-1), fUtf16(0), fBigEndian(1), fStart(1) {}
+};
+
 #include "xmllex.c++"
+#undef yylval			// the reentrant scanner macro would clash with the pure parser local
 
 using namespace std;
 
-int yyline = 1;
-
 #ifdef __cplusplus
 extern "C" {
 #endif
-//int		yyparse (void);
-void	yyerror(const char *s);
-int		libmxmlwrap();
+void	yyerror(void * scanner, parsestate * state, const char *s);
 bool	readfile   (const char * file, reader * r);
 bool	readstream (FILE * file, reader * r);
 bool	readbuffer (const char * buffer, reader * r);
+bool	readinplace (char * buffer, size_t size, reader * r);
 #ifdef __cplusplus
 }
 #endif
 
-int   yylex (void);
-extern char * libmxmltext;
-extern int libmxmllineno;
-extern FILE * libmxmlin;
-
-#define YYERROR_VERBOSE
-#define ERROR(str)	{ yyerror(str); YYABORT; }
-#define MAXLEN	1024
-#define VLEN	256
-char attributeName[MAXLEN];
-char attributeVal[MAXLEN];
-
-char xmlversion[VLEN];
-char xmlencoding[MAXLEN];
-int xmlStandalone = -1;
-
-char eltName[MAXLEN];
-char doctypeStart[MAXLEN];
-char doctypePub[MAXLEN];
-char doctypeSys[MAXLEN];
-
-reader * gReader;
-
-static void init (reader * r) {
-	gReader = r;
-	xmlStandalone = -1;
-	eltName[0]		= 0;
-	attributeName[0] = 0;
-	attributeVal[0] = 0;
-	xmlversion[0]   = 0;
-	xmlencoding[0]  = 0;
-	doctypeStart[0]	= 0;
-	doctypePub[0]	= 0;
-	doctypeSys[0]	= 0;
-}
+#define ERROR(str)	{ yyerror(scanner, state, str); YYABORT; }
+#define TEXT		yyget_text(scanner)
+#define SETLINE		state->fReader->setInputLineNumber (yyget_lineno(scanner))
 
 static char * unquote (char * text) {
 	int n = strlen(text);
@@ -78,14 +75,16 @@ static char * unquote (char * text) {
 	return text;
 }
 
-static void store (char * dst, const char * text) {
-	strcpy (dst, text);
-}
-
-int		libmxmlwrap()		{ return(1); }
-
 %}
 
+%code requires {
+struct parsestate;
+}
+
+%define api.pure full
+%define parse.error verbose
+%lex-param		{ void * scanner }
+%parse-param	{ void * scanner } { parsestate * state }
 
 %start document
 
@@ -113,15 +112,15 @@ eltstart	: LT eltname GT
 
 eltstop		: ENDXMLS endname GT;
 
-emptyelt	: LT eltname ENDXMLE					{ if (!gReader->endElement(eltName)) ERROR("end element error") }
-			| LT eltname SPACE attributes ENDXMLE   { if (!gReader->endElement(eltName)) ERROR("end element error") }
+emptyelt	: LT eltname ENDXMLE					{ if (!state->fReader->endElement(state->fEltName.c_str())) ERROR("end element error") }
+			| LT eltname SPACE attributes ENDXMLE   { if (!state->fReader->endElement(state->fEltName.c_str())) ERROR("end element error") }
 
-eltname		: NAME							{ store(eltName, libmxmltext); if (!gReader->newElement(libmxmltext)) ERROR("element error") }
-endname		: NAME							{ if (!gReader->endElement(libmxmltext)) ERROR("end element error") }
+eltname		: NAME							{ state->fEltName = TEXT; SETLINE; if (!state->fReader->newElement(TEXT)) ERROR("element error") }
+endname		: NAME							{ if (!state->fReader->endElement(TEXT)) ERROR("end element error") }
 
-attribute	: attrname EQ value				{ if (!gReader->newAttribute (attributeName, attributeVal)) ERROR("attribute error") }
-attrname	: NAME							{ store(attributeName, libmxmltext); }
-value		: QUOTEDSTR						{ store(attributeVal, unquote(libmxmltext)); }
+attribute	: attrname EQ value				{ if (!state->fReader->newAttribute (state->fAttributeName.c_str(), state->fAttributeVal.c_str())) ERROR("attribute error") }
+attrname	: NAME							{ state->fAttributeName = TEXT; }
+value		: QUOTEDSTR						{ state->fAttributeVal = unquote(TEXT); }
 
 attributes  : attribute	
 			| attributes SPACE attribute;
@@ -130,10 +129,10 @@ data		: /* empty */
 			| cdata
 			| elements ;
 
-cdata		: DATA							{ gReader->setValue (libmxmltext); }
+cdata		: DATA							{ state->fReader->setValue (TEXT); }
 
-procinstr	: PI							{ gReader->newProcessingInstruction (libmxmltext); }
-comment		: COMMENT						{ gReader->newComment (libmxmltext); }
+procinstr	: PI							{ SETLINE; state->fReader->newProcessingInstruction (TEXT); }
+comment		: COMMENT						{ SETLINE; state->fReader->newComment (TEXT); }
 
 comments 	:  comment
      		|  comments comment;
@@ -143,24 +142,24 @@ elements	: element
 
 
 xmldecl		: /* empty */
-			| XMLDECL versiondec decl ENDXMLDECL { if (!gReader->xmlDecl (xmlversion, xmlencoding, xmlStandalone)) ERROR("xmlDecl error") }
+			| XMLDECL versiondec decl ENDXMLDECL { if (!state->fReader->xmlDecl (state->fXmlVersion.c_str(), state->fXmlEncoding.c_str(), state->fXmlStandalone)) ERROR("xmlDecl error") }
 
 decl		: /* empty */
 			| encodingdec 
 			| stdalonedec
 			| encodingdec stdalonedec ;
 
-versiondec	: SPACE VERSION EQ QUOTEDSTR 		{ store(xmlversion, unquote(libmxmltext)); }
-encodingdec	: SPACE ENCODING EQ QUOTEDSTR 		{ store(xmlencoding, unquote(libmxmltext)); }
-stdalonedec	: SPACE STANDALONE EQ bool  		{ xmlStandalone = yylval; }
+versiondec	: SPACE VERSION EQ QUOTEDSTR 		{ state->fXmlVersion = unquote(TEXT); }
+encodingdec	: SPACE ENCODING EQ QUOTEDSTR 		{ state->fXmlEncoding = unquote(TEXT); }
+stdalonedec	: SPACE STANDALONE EQ bool  		{ state->fXmlStandalone = $4; }
 bool		: YES | NO ;
 
 doctype		: DOCTYPE SPACE startname SPACE id GT
-startname	: NAME 							{ store(doctypeStart, libmxmltext); }
-id			: PUBLIC SPACE publitteral SPACE syslitteral	{ gReader->docType (doctypeStart, true, doctypePub, doctypeSys); }
-			| SYSTEM SPACE syslitteral						{ gReader->docType (doctypeStart, false, doctypePub, doctypeSys); }
-publitteral : QUOTEDSTR 						{ store(doctypePub, unquote(libmxmltext)); }
-syslitteral : QUOTEDSTR 						{ store(doctypeSys, unquote(libmxmltext)); }
+startname	: NAME 							{ state->fDoctypeStart = TEXT; }
+id			: PUBLIC SPACE publitteral SPACE syslitteral	{ state->fReader->docType (state->fDoctypeStart.c_str(), true, state->fDoctypePub.c_str(), state->fDoctypeSys.c_str()); }
+			| SYSTEM SPACE syslitteral						{ state->fReader->docType (state->fDoctypeStart.c_str(), false, state->fDoctypePub.c_str(), state->fDoctypeSys.c_str()); }
+publitteral : QUOTEDSTR 						{ state->fDoctypePub = unquote(TEXT); }
+syslitteral : QUOTEDSTR 						{ state->fDoctypeSys = unquote(TEXT); }
 
 misc		: /* empty */
 			| SPACE ;
@@ -168,23 +167,59 @@ misc		: /* empty */
 
 %%
 
-#define yy_delete_buffer	libmxml_delete_buffer
-#define yy_scan_string		libmxml_scan_string
+//______________________________________________________________________________
+static bool parse (void * scanner, reader * r)
+{
+	parsestate state (r);
+	yyset_extra (&state, scanner);
+	int ret = yyparse (scanner, &state);
+	yylex_destroy (scanner);
+	return ret==0;
+}
 
 bool readbuffer (const char * buffer, reader * r) 
 {
 	if (!buffer) return false;		// error for empty buffers
 
-	init(r);
-	YY_BUFFER_STATE b;
-    // Copy string into new buffer and Switch buffers
-    b = yy_scan_string (buffer);
-    // Parse the string
-	int ret = yyparse();
-    // Delete the new buffer
-	yy_delete_buffer(b);
-	BEGIN(INITIAL);
- 	return ret==0;
+	void * scanner;
+	if (yylex_init (&scanner)) return false;
+	// Copy string into new buffer and Switch buffers
+	yy_scan_string (buffer, scanner);
+	// Parse the string, the buffer is deleted with the scanner
+	return parse (scanner, r);
+}
+
+// utf16 documents are narrowed in place, keeping the low byte of each character
+// as done by the scanner input functions for files
+static size_t narrowutf16 (char * buffer, size_t size)
+{
+	unsigned char * ptr = (unsigned char *)buffer;
+	if ((size < 2) || !(((ptr[0] == 0xff) && (ptr[1] == 0xfe)) || ((ptr[0] == 0xfe) && (ptr[1] == 0xff))))
+		return size;
+	size_t low = (ptr[0] == 0xfe) ? 1 : 0;
+	size_t n = 0;
+	for (size_t i = 2; i + 1 < size; i += 2)
+		buffer[n++] = buffer[i + low];
+	buffer[n] = buffer[n+1] = 0;
+	return n;
+}
+
+// the buffer holds size bytes followed by two null bytes, it is scanned without copy
+// and modified during the parse
+bool readinplace (char * buffer, size_t size, reader * r) 
+{
+	if (!buffer || buffer[size] || buffer[size+1]) return false;
+	size = narrowutf16 (buffer, size);
+
+	void * scanner;
+	if (yylex_init (&scanner)) return false;
+	if (!yy_scan_buffer (buffer, size + 2, scanner)) {
+		yylex_destroy (scanner);
+		return false;
+	}
+	yyset_lineno (1, scanner);		// not initialized by yy_scan_buffer
+	// the buffer state is deleted with the scanner, the buffer remains owned by the caller
+	return parse (scanner, r);
 }
 
 bool readfile (const char * file, reader * r) 
@@ -194,27 +229,21 @@ bool readfile (const char * file, reader * r)
 		cerr << "can't open file " << file << endl;
 		return false;
 	}
-	init(r);
-	libmxmlrestart(fd);
-	libmxmlin = fd;
- 	int ret = yyparse();
+	bool ret = readstream (fd, r);
  	fclose (fd);
-	BEGIN(INITIAL);
- 	return ret==0;
+ 	return ret;
 }
 
 bool readstream (FILE * fd, reader * r) 
 {
 	if (!fd) return false;
-	init(r);
-	libmxmlrestart(fd);
-	libmxmlin = fd;
- 	int ret = yyparse();
-	BEGIN(INITIAL);
- 	return ret==0;
+	void * scanner;
+	if (yylex_init (&scanner)) return false;
+	yyset_in (fd, scanner);
+	return parse (scanner, r);
 }
 
-void	yyerror(const char *s)	{ gReader->error (s, libmxmllineno); }
+void	yyerror(void * scanner, parsestate * state, const char *s)	{ state->fReader->error (s, yyget_lineno(scanner)); }
 
 #ifdef MAIN
 
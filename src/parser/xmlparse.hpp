@@ -1,8 +1,9 @@
-/* A Bison parser, made by GNU Bison 3.0.5.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
 /* Bison interface for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989-1990, 2000-2015, 2018 Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
    This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
@@ -15,7 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program.  If not, see <http://www.gnu.org/licenses/>.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -30,6 +31,10 @@
    This special exception was added by the Free Software Foundation in
    version 2.2 of Bison.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 #ifndef YY_LIBMXML_XMLPARSE_HPP_INCLUDED
 # define YY_LIBMXML_XMLPARSE_HPP_INCLUDED
 /* Debug traces.  */
@@ -39,34 +44,45 @@
 #if YYDEBUG
 extern int libmxmldebug;
 #endif
+/* "%code requires" blocks.  */
+#line 80 "xml.y"
+
+struct parsestate;
+
+#line 53 "xmlparse.hpp"
 
-/* Token type.  */
+/* Token kinds.  */
 #ifndef YYTOKENTYPE
 # define YYTOKENTYPE
   enum yytokentype
   {
-    XMLDECL = 258,
-    VERSION = 259,
-    ENCODING = 260,
-    STANDALONE = 261,
-    YES = 262,
-    NO = 263,
-    ENDXMLDECL = 264,
-    DOCTYPE = 265,
-    PUBLIC = 266,
-    SYSTEM = 267,
-    COMMENT = 268,
-    PI = 269,
-    NAME = 270,
-    DATA = 271,
-    QUOTEDSTR = 272,
-    SPACE = 273,
-    LT = 274,
-    GT = 275,
-    ENDXMLS = 276,
-    ENDXMLE = 277,
-    EQ = 278
+    YYEMPTY = -2,
+    YYEOF = 0,                     /* "end of file"  */
+    YYerror = 256,                 /* error  */
+    YYUNDEF = 257,                 /* "invalid token"  */
+    XMLDECL = 258,                 /* XMLDECL  */
+    VERSION = 259,                 /* VERSION  */
+    ENCODING = 260,                /* ENCODING  */
+    STANDALONE = 261,              /* STANDALONE  */
+    YES = 262,                     /* YES  */
+    NO = 263,                      /* NO  */
+    ENDXMLDECL = 264,              /* ENDXMLDECL  */
+    DOCTYPE = 265,                 /* DOCTYPE  */
+    PUBLIC = 266,                  /* PUBLIC  */
+    SYSTEM = 267,                  /* SYSTEM  */
+    COMMENT = 268,                 /* COMMENT  */
+    PI = 269,                      /* PI  */
+    NAME = 270,                    /* NAME  */
+    DATA = 271,                    /* DATA  */
+    QUOTEDSTR = 272,               /* QUOTEDSTR  */
+    SPACE = 273,                   /* SPACE  */
+    LT = 274,                      /* LT  */
+    GT = 275,                      /* GT  */
+    ENDXMLS = 276,                 /* ENDXMLS  */
+    ENDXMLE = 277,                 /* ENDXMLE  */
+    EQ = 278                       /* EQ  */
   };
+  typedef enum yytokentype yytoken_kind_t;
 #endif
 
 /* Value type.  */
@@ -77,8 +93,9 @@ typedef int YYSTYPE;
 #endif
 
 
-extern YYSTYPE libmxmllval;
 
-int libmxmlparse (void);
+
+int libmxmlparse (void * scanner, parsestate * state);
+
 
 #endif /* !YY_LIBMXML_XMLPARSE_HPP_INCLUDED  */
@@ -18,13 +18,45 @@
 #pragma warning (disable : 4251 4275)
 #endif
 
+#include <cstddef>
+#include <vector>
+
 namespace MusicXML2 
 {
 
+/*!
+\brief base class for visitors
+
+	A visitor keeps a cache of its visitor interfaces, indexed by the type
+	of the visited objects: the interfaces are resolved once per type (using
+	dynamic_cast) and the subsequent visits make an indexed call.
+*/
 class basevisitor 
 {
 	public:
+		//! the visitor interfaces for a given type of visited objects
+		struct interfaces {
+			void*	fTyped;		///< the interface for the exact type of the object, when implemented
+			void*	fGeneric;	///< the interface for the generic type of the object, when implemented
+			bool	fResolved;	///< false until the interfaces have been resolved
+		};
+
+				 basevisitor() {}
+				 basevisitor(const basevisitor&) {}		// the cache refers to the visitor itself and is not copied
 		virtual ~basevisitor() {}
+		basevisitor& operator= (const basevisitor&)	{ return *this; }
+
+		//! gives the interfaces for the type index, to be resolved by the caller when not yet done
+		interfaces& dispatch (std::size_t index) {
+			if (index >= fDispatch.size()) {
+				interfaces none = { 0, 0, false };
+				fDispatch.resize (index + 1, none);
+			}
+			return fDispatch[index];
+		}
+
+	private:
+		std::vector<interfaces>	fDispatch;
 };
 
 }
@@ -25,13 +25,13 @@ namespace MusicXML2
 //______________________________________________________________________________
 void clonevisitor::copyAttributes (const Sxmlelement& src, Sxmlelement& dst )
 {
-	vector<Sxmlattribute> attr = src->attributes();
+	const vector<Sxmlattribute>& attr = src->attributes();
 	vector<Sxmlattribute>::const_iterator iter;
 	for (iter=attr.begin(); iter != attr.end(); iter++) {
 		Sxmlattribute attrcopy = xmlattribute::create();
 		attrcopy->setName( (*iter)->getName());
 		attrcopy->setValue( (*iter)->getValue());
-		dst->add( attrcopy );
+		dst->add( std::move(attrcopy) );
 	}
 }
 
@@ -56,8 +56,10 @@ void clonevisitor::visitStart ( Sxmlelement& elt )
 	copy->setValue( elt->getValue());
 	copyAttributes (elt, copy);
 	fLastCopy = copy;
-	if (fStack.empty())
-		fStack.push(copy);
+	if (fStack.empty()) {
+		fRoot = copy;
+		fStack.push(fRoot);
+	}
 	else fStack.top()->push(copy);
 	if (!elt->empty()) fStack.push(copy);
 }
@@ -38,7 +38,7 @@ class EXP clonevisitor :
 		virtual void visitStart( Sxmlelement& elt );
 		virtual void visitEnd  ( Sxmlelement& elt );
 		
-		virtual Sxmlelement clone()	{ return fStack.top(); }
+		virtual Sxmlelement clone()	{ return fStack.top().own(); }
 
 	protected:
 		virtual void			clone(bool state)	{ fClone = state; }
@@ -48,7 +48,8 @@ class EXP clonevisitor :
 
 		bool					fClone;
 		Sxmlelement				fLastCopy;
-		std::stack<Sxmlelement> fStack;
+		Sxmlelement				fRoot;		///< the copy of the visited tree root, owns the copies
+		std::stack<borrowed<xmlelement> > fStack;	///< the copies owned by their parents
 };
 
 /*! @} */
@@ -84,7 +84,7 @@ midicontextvisitor::midicontextvisitor(long tpq, midiwriter* writer)
 {
 	fTPQ = tpq;
 	fMidiWriter = writer;
-	fInBackup = fInForward = false;
+	fInBackup = fInForward = fInSound = false;
     fEndMeasureDate = 0;
 	fEndPartDate = 0;
 
@@ -15,12 +15,43 @@
 #endif
 
 #include "partsummary.h"
+#include "xml_tree_browser.h"
 
 using namespace std;
 
 namespace MusicXML2
 {
 
+//________________________________________________________________________
+// the summary attached to a part element
+class cachedpartsummary : public partsummary, public smartable
+{
+	public:
+		unsigned long	fModifications;		// the part modifications stamp when the summary was computed
+
+		static SMARTP<cachedpartsummary> create()	{ cachedpartsummary* o = new cachedpartsummary; assert(o!=0); return o; }
+
+	protected:
+				 cachedpartsummary() : fModifications(0) {}
+		virtual ~cachedpartsummary() {}
+};
+
+const partsummary& partsummary::get (const S_part& part)
+{
+	unsigned long modifications = part->modifications();
+	cachedpartsummary* summary = static_cast<cachedpartsummary*>((smartable*)part->fSummary);
+	if (!summary || (summary->fModifications != modifications)) {
+		SMARTP<cachedpartsummary> ps = cachedpartsummary::create();
+		xml_tree_browser browser(ps);
+		browser.browse(*part);
+		ps->fModifications = modifications;
+		ps->update();
+		summary = ps;
+		part->fSummary = summary;
+	}
+	return *summary;
+}
+
 //________________________________________________________________________
 void partsummary::visitStart ( S_part& elt)
 {
@@ -28,6 +59,52 @@ void partsummary::visitStart ( S_part& elt)
 	fStaves.clear();
 	fVoices.clear();
 	fStaffVoices.clear();
+	fMeasures.clear();
+	fMeasureOffsets.clear();
+	fDivisions = 1;
+	fMeasureStart = 0;
+	fUpToDate = false;
+}
+
+//________________________________________________________________________
+void partsummary::visitStart ( S_measure& elt)
+{
+	fMeasures.push_back (elt->getAttributeValue("number"));
+	fMeasureOffsets.push_back (fMeasureStart);
+	fPosition = fMeasureLength = 0;
+}
+
+//________________________________________________________________________
+// the measure length is the farthest position reached in the measure
+void partsummary::visitEnd ( S_measure& elt)
+{
+	fMeasureStart += fMeasureLength;
+}
+
+//________________________________________________________________________
+void partsummary::moveTo (const rational& position)
+{
+	fPosition = position;
+	if (fPosition > fMeasureLength) fMeasureLength = fPosition;
+}
+
+//________________________________________________________________________
+void partsummary::visitStart ( S_divisions& elt)
+{
+	long divisions = long(*elt);
+	if (divisions > 0) fDivisions = divisions;
+}
+
+//________________________________________________________________________
+void partsummary::visitStart ( S_backup& elt)
+{
+	moveTo (fPosition - rational(elt->getIntValue(k_duration, 0), fDivisions * 4));
+}
+
+//________________________________________________________________________
+void partsummary::visitStart ( S_forward& elt)
+{
+	moveTo (fPosition + rational(elt->getIntValue(k_duration, 0), fDivisions * 4));
 }
 
 //________________________________________________________________________
@@ -66,15 +143,43 @@ void partsummary::visitEnd ( S_note& elt)
 	fStaves[notevisitor::getStaff()]++;
 	fVoices[notevisitor::getVoice()]++;
 	fStaffVoices[notevisitor::getStaff()][notevisitor::getVoice()]++;
+	if (!isGrace() && !inChord())
+		moveTo (fPosition + rational(getDuration(), fDivisions * 4));
+	fUpToDate = false;
+}
+
+//________________________________________________________________________
+// the main staff of a voice is the staff that contains the more of the voice notes
+void partsummary::update () const
+{
+	if (fUpToDate) return;
+	fVoicesIDs.clear();
+	for (map<int, int>::const_iterator i = fVoices.begin(); i != fVoices.end(); i++)
+		fVoicesIDs.push_back (i->first);
+	fStavesIDs.clear();
+	for (map<int, int>::const_iterator i = fStaves.begin(); i != fStaves.end(); i++)
+		fStavesIDs.push_back (i->first);
+
+	fMainStaves.clear();
+	map<int, int> maxnotes;
+	for (map<int, map<int, int> >::const_iterator i = fStaffVoices.begin(); i != fStaffVoices.end(); i++) {
+		for (map<int, int>::const_iterator v = i->second.begin(); v != i->second.end(); v++) {
+			int& max = maxnotes[v->first];
+			if (v->second > max) {
+				max = v->second;
+				fMainStaves[v->first] = i->first;
+			}
+		}
+	}
+	fUpToDate = true;
 }
 
 //________________________________________________________________________
 smartlist<int>::ptr partsummary::getStaves() const
 {
 	smartlist<int>::ptr sl = smartlist<int>::create();
-	for ( map<int, int>::const_iterator i = fStaves.begin(); i != fStaves.end(); i++) {
-		sl->push_back (i->first);
-	}
+	const vector<int>& ids = staves();
+	sl->insert (sl->end(), ids.begin(), ids.end());
 	return sl;
 }
 
@@ -94,9 +199,8 @@ smartlist<int>::ptr partsummary::getStaves (int voice) const
 smartlist<int>::ptr partsummary::getVoices () const
 {
 	smartlist<int>::ptr sl = smartlist<int>::create();
-	for ( map<int, int>::const_iterator i = fVoices.begin(); i != fVoices.end(); i++) {
-		sl->push_back (i->first);
-	}
+	const vector<int>& ids = voices();
+	sl->insert (sl->end(), ids.begin(), ids.end());
 	return sl;
 }
 
@@ -138,17 +242,9 @@ int partsummary::getStaffNotes (int id) const
 //________________________________________________________________________
 int partsummary::getMainStaff (int voiceid) const
 {
-	smartlist<int>::ptr v = getStaves (voiceid);
-	int staffid = 0;
-	int maxnotes = 0;
-	for (vector<int>::const_iterator i = v->begin(); i != v->end(); i++) {
-		int n = getVoiceNotes (*i, voiceid);
-		if (n > maxnotes) {
-			maxnotes = n;
-			staffid = *i;
-		}
-	}
-	return staffid;
+	update();
+	map<int, int>::const_iterator i = fMainStaves.find( voiceid );
+	return (i != fMainStaves.end()) ? i->second : 0;
 }
 
 //________________________________________________________________________
@@ -14,9 +14,11 @@
 #define __partsummary__
 
 #include <map>
+#include <string>
 #include <vector>
 
 #include "notevisitor.h"
+#include "rational.h"
 #include "smartlist.h"
 
 namespace MusicXML2
@@ -34,16 +36,37 @@ namespace MusicXML2
 	- a count of staves
 	- a map that associate each stave with the corresponding number of notes
 	- a map that associate each stave with the corresponding voices and notes
+	- the main staff of each voice
+	- the numbers of the measures
+	- the offsets of the measures from the start of the part
+	
+	The summary of a part can be computed once and kept with the part element
+	using partsummary::get(): the visitors that convert the same tree several
+	times share it.
+	The offsets are rationals: browsing a part whose offsets can't be computed
+	without overflowing throws std::overflow_error (see rational).
 */
 class EXP partsummary : 
 	public notevisitor,
 	public visitor<S_part>,
+	public visitor<S_measure>,
+	public visitor<S_divisions>,
+	public visitor<S_backup>,
+	public visitor<S_forward>,
     public visitor<S_staves>,
 	public visitor<S_print>
 {
 	public:
-				 partsummary() : fStavesCount(1) {};
+				 partsummary() : fStavesCount(1), fDivisions(1), fUpToDate(false) {};
 		virtual	~partsummary() {};
+
+		/*!
+			\brief gives the summary of a part
+			The summary is computed at first call and attached to the part element.
+			It is computed again after any modification of the part (see xmlelement::modifications()).
+			As the tree itself, it is not protected against concurrent accesses.
+		*/
+		static const partsummary& get (const S_part& part);
 		
 		//! returns the number of staves for the part
 		int countStaves () const				{ return fStavesCount; }
@@ -61,6 +84,10 @@ class EXP partsummary :
 
 		//! returns the voices ids list
 		smartlist<int>::ptr getVoices () const;
+		//! returns the voices ids, in increasing order
+		const std::vector<int>& voices () const		{ update(); return fVoicesIDs; }
+		//! returns the staves ids, in increasing order
+		const std::vector<int>& staves () const		{ update(); return fStavesIDs; }
 		//! returns the voices ids list for one staff
 		smartlist<int>::ptr getVoices (int staff) const;
 		//! returns the id of the staff that contains the more of the voice notes
@@ -69,11 +96,22 @@ class EXP partsummary :
 		int getVoiceNotes (int voiceid) const;
 		//! returns the count of notes on a voice and a staff
 		int getVoiceNotes (int staffid, int voiceid) const;
+		//! returns the count of measures
+		int countMeasures () const							{ return int(fMeasures.size()); }
+		//! returns the numbers of the measures, in the part order
+		const std::vector<std::string>& measures () const	{ return fMeasures; }
+		//! returns the offsets of the measures from the start of the part, in whole notes
+		const std::vector<rational>& measureOffsets () const	{ return fMeasureOffsets; }
     // staff distance from S_print
     std::map<int, int> fStaffDistances;
 		
 	protected:
 		virtual void visitStart ( S_part& elt);
+		virtual void visitStart ( S_measure& elt);
+		virtual void visitEnd   ( S_measure& elt);
+		virtual void visitStart ( S_divisions& elt);
+		virtual void visitStart ( S_backup& elt);
+		virtual void visitStart ( S_forward& elt);
         virtual void visitStart ( S_staves& elt);
 		virtual void visitStart ( S_print& elt);
 		virtual void visitEnd   ( S_note& elt);
@@ -87,6 +125,22 @@ class EXP partsummary :
 		std::map<int, int>	fVoices;
 		// staves and corresponding voices + count of notes
 		std::map<int, std::map<int, int> >	fStaffVoices;
+		// the measures numbers
+		std::vector<std::string>	fMeasures;
+		// the measures offsets
+		std::vector<rational>		fMeasureOffsets;
+
+		// the current divisions, the current offset in the measure and the measure length
+		long		fDivisions;
+		rational	fMeasureStart, fPosition, fMeasureLength;
+		void		moveTo (const rational& position);
+
+		// the ids lists and the main staves, computed from the maps above when required
+		mutable bool				fUpToDate;
+		mutable std::vector<int>	fVoicesIDs;
+		mutable std::vector<int>	fStavesIDs;
+		mutable std::map<int, int>	fMainStaves;
+		void	update () const;
     
 };
 
@@ -23,11 +23,23 @@ namespace MusicXML2
 @{
 */
 
+/*!
+\brief the visitor interface of a type
+
+	When C is a smart pointer, the elements visited by the way of their
+	acceptIn and acceptOut methods are given as a borrowed reference
+	(see borrowed::ref): the smart pointer holds no reference to the element.
+	It can be read and copied but it must not be assigned, moved or reset:
+	the reference count of the element would be corrupted. The constraint
+	is asserted when the visit returns.
+*/
 template<class C> class visitor : virtual public basevisitor
 {
     public:
 		virtual ~visitor() {}
+		//! called when entering an element, elt must not be modified (see above)
 		virtual void visitStart( C& elt ) {};
+		//! called when leaving an element, elt must not be modified (see above)
 		virtual void visitEnd  ( C& elt ) {};
 };
 
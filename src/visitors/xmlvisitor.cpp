@@ -28,7 +28,7 @@ ostream& operator<< (ostream& os, const xmlendl& endl)
 //______________________________________________________________________________
 void xmlendl::print(std::ostream& os) const { 
 	int i = fIndent;
-    os << std::endl;
+    os << '\n';
     while (i-- > 0)  os << "    ";
 }
 
@@ -0,0 +1,192 @@
+/*
+  MusicXML Library
+  Copyright (C) Grame 2006-2013
+
+  This Source Code Form is subject to the terms of the Mozilla Public
+  License, v. 2.0. If a copy of the MPL was not distributed with this
+  file, You can obtain one at http://mozilla.org/MPL/2.0/.
+
+  Grame Research Laboratory, 11, cours de Verdun Gensoul 69002 Lyon - France
+  research@grame.fr
+*/
+
+/*
+  writes the results of the MSR interval and pitch arithmetic
+  for all their inputs, one line per first operand,
+  to be compared with intervals.txt by 'make intervals'
+*/
+
+#include <iostream>
+
+#include "utilities.h"
+
+#include "generalOptions.h"
+
+#include "msr.h"
+#include "lpsr.h"
+
+#include "xml2lyOptionsHandling.h"
+
+
+using namespace std;
+
+using namespace MusicXML2;
+
+// the relative octaves of the chord intervals operands
+static const int kMinRelativeOctave = -1;
+static const int kMaxRelativeOctave =  1;
+
+//_______________________________________________________________________________
+static void writeChordInterval (
+  S_msrChordInterval chordInterval)
+{
+  cout <<
+    " " << chordInterval->getChordIntervalIntervalKind ();
+
+  if (int relativeOctave = chordInterval->getChordIntervalRelativeOctave ()) {
+    cout <<
+      ":" << relativeOctave;
+  }
+}
+
+static void writeChordIntervalsOperations (
+  bool sum)
+{
+  cout <<
+    (sum ? "intervalSum" : "intervalDifference") <<
+    endl;
+
+  for (int i = k_NoIntervalKind; i <= kAugmentedThirteenth; i++) {
+    for (int o = kMinRelativeOctave; o <= kMaxRelativeOctave; o++) {
+      S_msrChordInterval
+        chordInterval1 =
+          msrChordInterval::create (
+            msrIntervalKind (i), o);
+
+      cout <<
+        i << ":" << o;
+
+      for (int j = k_NoIntervalKind; j <= kAugmentedThirteenth; j++) {
+        for (int p = kMinRelativeOctave; p <= kMaxRelativeOctave; p++) {
+          S_msrChordInterval
+            chordInterval2 =
+              msrChordInterval::create (
+                msrIntervalKind (j), p);
+
+          writeChordInterval (
+            sum
+              ? chordInterval1->intervalSum (chordInterval2)
+              : chordInterval1->intervalDifference (chordInterval2));
+        } // for
+      } // for
+
+      cout << endl;
+    } // for
+  } // for
+}
+
+//_______________________________________________________________________________
+int main (int argc, char *argv[])
+{
+  initializeMSR ();
+  initializeLPSR ();
+
+  S_xml2lyOptionsHandler
+    optionsHandler =
+      xml2lyOptionsHandler::create (
+        gOutputIOstream);
+
+  // the unsupported inputs return after the msrLimitation
+  gGeneralOptions->fQuiet        = true;
+  gGeneralOptions->fIgnoreErrors = true;
+
+  cout <<
+    "msrIntervalKindAsSemiTones" <<
+    endl;
+  for (int i = k_NoIntervalKind; i <= kAugmentedThirteenth; i++) {
+    cout <<
+      " " << msrIntervalKindAsSemiTones (msrIntervalKind (i));
+  } // for
+  cout << endl;
+
+  cout <<
+    "intervalKindAsSemitones" <<
+    endl;
+  for (int i = k_NoIntervalKind; i <= kAugmentedThirteenth; i++) {
+    cout <<
+      " " << intervalKindAsSemitones (msrIntervalKind (i));
+  } // for
+  cout << endl;
+
+  cout <<
+    "semiTonesPitchKindFromQuarterTonesPitchKind" <<
+    endl;
+  for (int q = k_NoQuarterTonesPitch_QTP; q <= kG_TripleSharp_QTP; q++) {
+    cout <<
+      " " <<
+      semiTonesPitchKindFromQuarterTonesPitchKind (
+        msrQuarterTonesPitchKind (q));
+  } // for
+  cout << endl;
+
+  cout <<
+    "noteAtIntervalFromSemiTonesPitch" <<
+    endl;
+  for (int s = k_NoSemiTonesPitch_STP; s <= kB_TripleSharp_STP; s++) {
+    cout << s << ":";
+    for (int i = k_NoIntervalKind; i <= kAugmentedThirteenth; i++) {
+      cout <<
+        " " <<
+        noteAtIntervalFromSemiTonesPitch (
+          0, msrIntervalKind (i), msrSemiTonesPitchKind (s));
+    } // for
+    cout << endl;
+  } // for
+
+  cout <<
+    "noteAtIntervalFromQuarterTonesPitch" <<
+    endl;
+  for (int q = k_NoQuarterTonesPitch_QTP; q <= kG_TripleSharp_QTP; q++) {
+    cout << q << ":";
+    for (int i = k_NoIntervalKind; i <= kAugmentedThirteenth; i++) {
+      cout <<
+        " " <<
+        noteAtIntervalFromQuarterTonesPitch (
+          0, msrIntervalKind (i), msrQuarterTonesPitchKind (q));
+    } // for
+    cout << endl;
+  } // for
+
+  cout <<
+    "intervalBetweenSemiTonesPitches" <<
+    endl;
+  for (int s = k_NoSemiTonesPitch_STP; s <= kB_TripleSharp_STP; s++) {
+    cout << s << ":";
+    for (int t = k_NoSemiTonesPitch_STP; t <= kB_TripleSharp_STP; t++) {
+      cout <<
+        " " <<
+        intervalBetweenSemiTonesPitches (
+          msrSemiTonesPitchKind (s), msrSemiTonesPitchKind (t));
+    } // for
+    cout << endl;
+  } // for
+
+  cout <<
+    "enharmonicSemiTonesPitch" <<
+    endl;
+  for (int s = k_NoSemiTonesPitch_STP; s <= kB_TripleSharp_STP; s++) {
+    cout << s << ":";
+    for (int a = kPreferFlat; a <= kPreferSharp; a++) {
+      cout <<
+        " " <<
+        enharmonicSemiTonesPitch (
+          msrSemiTonesPitchKind (s), msrAlterationPreferenceKind (a));
+    } // for
+    cout << endl;
+  } // for
+
+  writeChordIntervalsOperations (false);
+  writeChordIntervalsOperations (true);
+
+  return 0;
+}